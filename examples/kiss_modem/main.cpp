@@ -54,6 +54,7 @@ void loadOrCreateIdentity() {
 
 void onSetRadio(float freq, float bw, uint8_t sf, uint8_t cr) {
   radio_set_params(freq, bw, sf, cr);
+  radio_driver.onParamsChanged();
 }
 
 void onSetTxPower(uint8_t power) {
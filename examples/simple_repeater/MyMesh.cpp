@@ -232,10 +232,18 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
     stats.n_recv_direct = getNumRecvDirect();
     stats.err_events = _err_flags;
     stats.last_snr = (int16_t)(radio_driver.getLastSNR() * 4);
-    stats.n_direct_dups = ((SimpleMeshTables *)getTables())->getNumDirectDups();
-    stats.n_flood_dups = ((SimpleMeshTables *)getTables())->getNumFloodDups();
+    stats.n_direct_dups = ((RepeaterMeshTables *)getTables())->getNumDirectDups();
+    stats.n_flood_dups = ((RepeaterMeshTables *)getTables())->getNumFloodDups();
     stats.total_rx_air_time_secs = getReceiveAirTime() / 1000;
     stats.n_recv_errors = radio_driver.getPacketsRecvErrors();
+    stats.n_tx_queue_full = _mgr->getNumDropped(DROP_TX_QUEUE_FULL);
+    stats.n_tx_evicted = _mgr->getNumDropped(DROP_TX_EVICTED);
+    stats.n_rx_queue_full = _mgr->getNumDropped(DROP_RX_QUEUE_FULL);
+    stats.n_pool_empty = _mgr->getNumDropped(DROP_POOL_EMPTY);
+    stats.n_tx_expired = _mgr->getNumDropped(DROP_TX_EXPIRED);
+    stats.n_tx_suppressed = _mgr->getNumDropped(DROP_TX_SUPPRESSED);
+    stats.flood_fwd_pct = flood_fwd_pct;
+    stats.flood_fwd_ratio = getNumFloodFwdEligible() ? (uint16_t)((uint64_t)(getNumFloodFwdEligible() - getNumFloodFwdSkipped()) * 1000 / getNumFloodFwdEligible()) : 1000;
     memcpy(&reply_data[4], &stats, sizeof(stats));
 
     return 4 + sizeof(stats); //  reply_len
@@ -437,6 +445,45 @@ bool MyMesh::allowPacketForward(const mesh::Packet *packet) {
   return true;
 }
 
+#define GOSSIP_NEIGHBOUR_SECS   (24*60*60)   // neighbours heard within this long count towards density
+#define GOSSIP_SAMPLE_MILLIS    60000        // min interval for re-sampling flood duplicate rate
+#define GOSSIP_MIN_SAMPLE       8            // min flood packets per sample
+
+uint8_t MyMesh::getFloodForwardPercent(const mesh::Packet *packet) {
+  if (_prefs.flood_gossip_k == 0) return flood_fwd_pct = 100;   // gossip disabled
+  if (packet->getPathHashCount() == 0) return 100;   // heard direct from originator, always forward
+
+  // estimate how many neighbours re-transmit each flood packet, from the duplicate rate
+  uint32_t recv = getNumRecvFlood();
+  uint32_t dups = ((RepeaterMeshTables *)getTables())->getNumFloodDups();
+  if (recv < gossip_prev_recv || dups < gossip_prev_dups) {   // stats were cleared
+    gossip_prev_recv = recv;
+    gossip_prev_dups = dups;
+  } else if (millisHasNowPassed(gossip_sample_at) && recv - gossip_prev_recv >= GOSSIP_MIN_SAMPLE) {
+    uint32_t n = recv - gossip_prev_recv;
+    uint32_t unique = n - (dups - gossip_prev_dups);
+    if (unique > 0) {
+      flood_copies_x16 = (flood_copies_x16 * 3 + n * 16 / unique) / 4;   // smoothed
+    }
+    gossip_prev_recv = recv;
+    gossip_prev_dups = dups;
+    gossip_sample_at = futureMillis(GOSSIP_SAMPLE_MILLIS);
+  }
+  // NOTE: both are lower bounds of actual density (neighbours may be gossiping too), so errs on forwarding more
+  int density = flood_copies_x16 / 16;
+#if MAX_NEIGHBOURS
+  uint32_t now = getRTCClock()->getCurrentTime();
+  int num_neighbours = 0;
+  for (int i = 0; i < MAX_NEIGHBOURS; i++) {
+    if (neighbours[i].heard_timestamp > 0 && now - neighbours[i].heard_timestamp < GOSSIP_NEIGHBOUR_SECS) num_neighbours++;
+  }
+  if (num_neighbours > density) density = num_neighbours;
+#endif
+
+  if (density <= _prefs.flood_gossip_k) return flood_fwd_pct = 100;
+  return flood_fwd_pct = 100 * _prefs.flood_gossip_k / density;
+}
+
 const char *MyMesh::getLogDateTime() {
   static char tmp[32];
   uint32_t now = getRTCClock()->getCurrentTime();
@@ -828,9 +875,17 @@ void MyMesh::sendNodeDiscoverReq() {
   }
 }
 
+static mesh::PacketManager* newPacketManager() {
+#ifdef USE_SLAB_PACKET_MANAGER
+  return new SlabPacketManager(SLAB_NUM_WORKING, SLAB_NUM_SMALL, SLAB_NUM_MEDIUM, SLAB_NUM_LARGE);
+#else
+  return new StaticPoolPacketManager(32);
+#endif
+}
+
 MyMesh::MyMesh(mesh::MainBoard &board, mesh::Radio &radio, mesh::MillisecondClock &ms, mesh::RNG &rng,
                mesh::RTCClock &rtc, mesh::MeshTables &tables)
-    : mesh::Mesh(radio, ms, rng, rtc, *new StaticPoolPacketManager(32), tables),
+    : mesh::Mesh(radio, ms, rng, rtc, *newPacketManager(), tables),
       _cli(board, rtc, sensors, acl, &_prefs, this), telemetry(MAX_PACKET_PAYLOAD - 4), region_map(key_store), temp_map(key_store),
       discover_limiter(4, 120),  // max 4 every 2 minutes
       anon_limiter(4, 180)   // max 4 every 3 minutes
@@ -845,6 +900,11 @@ MyMesh::MyMesh(mesh::MainBoard &board, mesh::Radio &radio, mesh::MillisecondCloc
   uptime_millis = 0;
   next_local_advert = next_flood_advert = 0;
   dirty_contacts_expiry = 0;
+  gossip_sample_at = 0;
+  seen_snapshot_at = 0;
+  gossip_prev_recv = gossip_prev_dups = 0;
+  flood_copies_x16 = 16;
+  flood_fwd_pct = 100;
   set_radio_at = revert_radio_at = 0;
   _logging = false;
   region_load_active = false;
@@ -872,6 +932,9 @@ MyMesh::MyMesh(mesh::MainBoard &board, mesh::Radio &radio, mesh::MillisecondCloc
   _prefs.flood_advert_interval = 12; // 12 hours
   _prefs.flood_max = 64;
   _prefs.interference_threshold = 0; // disabled
+  _prefs.flood_suppress = 0;  // disabled
+  _prefs.flood_gossip_k = 0;  // disabled
+  memset(_prefs.airtime_shares, 0, sizeof(_prefs.airtime_shares));  // one shared budget
 
   // bridge defaults
   _prefs.bridge_enabled = 1;    // enabled
@@ -907,8 +970,9 @@ void MyMesh::begin(FILESYSTEM *fs) {
   // load persisted prefs
   _cli.loadPrefs(_fs);
   acl.load(_fs, self_id);
-  // TODO: key_store.begin();
+  key_store.begin(_fs);
   region_map.load(_fs);
+  restoreSeenTables();
 
 #if defined(WITH_BRIDGE)
   if (_prefs.bridge_enabled) {
@@ -917,6 +981,7 @@ void MyMesh::begin(FILESYSTEM *fs) {
 #endif
 
   radio_set_params(_prefs.freq, _prefs.bw, _prefs.sf, _prefs.cr);
+  _radio->onParamsChanged();
   radio_set_tx_power(_prefs.tx_power_dbm);
 
   radio_driver.setRxBoostedGainMode(_prefs.rx_boosted_gain);
@@ -1092,10 +1157,83 @@ void MyMesh::saveIdentity(const mesh::LocalIdentity &new_id) {
   store.save("_main", new_id);
 }
 
+#ifndef SEEN_SNAPSHOT_MILLIS
+  #define SEEN_SNAPSHOT_MILLIS   30000   // how often seen-packet tables are copied to retained RAM
+#endif
+
+// RAM which survives a reset (but not power loss), so seen-packet tables can be restored after a crash or reboot
+#if defined(ESP32)
+  #define SEEN_RETAINED_ATTR  RTC_NOINIT_ATTR     // RTC slow memory, also survives deep sleep
+#elif defined(NRF52_PLATFORM)
+  #define SEEN_RETAINED_ATTR  __attribute__((section(".noinit")))
+#elif defined(RP2040_PLATFORM)
+  #define SEEN_RETAINED_ATTR  __attribute__((section(".uninitialized_data")))
+#endif   // else: only saved to file, before a 'reboot' command
+
+#if defined(SEEN_RETAINED_ATTR) && !defined(USE_BLOOM_MESH_TABLES)
+static SEEN_RETAINED_ATTR uint8_t seen_retained[12 + MAX_PACKET_HASHES*(MAX_HASH_SIZE + 2) + MAX_PACKET_ACKS*(ACK_KEY_SIZE + 2) + 4];
+#endif
+
+void MyMesh::saveSeenTables(bool to_file) {
+#ifndef USE_BLOOM_MESH_TABLES
+  auto tables = (SimpleMeshTables *)getTables();
+  uint32_t now = getRTCClock()->getCurrentTime();
+  #ifdef SEEN_RETAINED_ATTR
+  tables->saveTo(seen_retained, sizeof(seen_retained), now);
+  #endif
+
+  if (to_file) {
+    int max_len = tables->getMaxSnapshotSize();
+    uint8_t* buf = new uint8_t[max_len];
+    int len = tables->saveTo(buf, max_len, now);
+    _fs->remove(SEEN_TABLES_FILE);
+    File f = openAppend(SEEN_TABLES_FILE);
+    if (f) {
+      f.write(buf, len);
+      f.close();
+    }
+    delete[] buf;
+  }
+#endif
+}
+
+void MyMesh::restoreSeenTables() {
+#ifndef USE_BLOOM_MESH_TABLES
+  auto tables = (SimpleMeshTables *)getTables();
+  uint32_t now = getRTCClock()->getCurrentTime();
+  bool restored = false;
+  #ifdef SEEN_RETAINED_ATTR
+  restored = tables->restoreFrom(seen_retained, sizeof(seen_retained), now, true);
+  memset(seen_retained, 0, 4);   // only use once
+  #endif
+
+  if (_fs->exists(SEEN_TABLES_FILE)) {
+    if (!restored) {
+      int max_len = tables->getMaxSnapshotSize();
+      uint8_t* buf = new uint8_t[max_len];
+    #if defined(RP2040_PLATFORM)
+      File f = _fs->open(SEEN_TABLES_FILE, "r");
+    #else
+      File f = _fs->open(SEEN_TABLES_FILE);
+    #endif
+      if (f) {
+        int len = f.read(buf, max_len);
+        f.close();
+        restored = tables->restoreFrom(buf, len, now, false);
+      }
+      delete[] buf;
+    }
+    _fs->remove(SEEN_TABLES_FILE);   // only use once
+  }
+  MESH_DEBUG_PRINTLN("restoreSeenTables: %s", restored ? "restored" : "none");
+#endif
+}
+
 void MyMesh::clearStats() {
   radio_driver.resetStats();
   resetStats();
-  ((SimpleMeshTables *)getTables())->resetStats();
+  ((RepeaterMeshTables *)getTables())->resetStats();
+  _mgr->resetDropCounts();
 }
 
 void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply) {
@@ -1246,7 +1384,10 @@ void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply
     } else if (n >= 3 && strcmp(parts[1], "remove") == 0) {
       auto region = region_map.findByName(parts[2]);
       if (region) {
+        uint16_t id = region->id;
+        bool is_private = region->name[0] == '$';
         if (region_map.removeRegion(*region)) {
+          if (is_private) key_store.removeKeys(id);
           strcpy(reply, "OK");
         } else {
           strcpy(reply, "Err - not empty");
@@ -1254,6 +1395,30 @@ void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply
       } else {
         strcpy(reply, "Err - not found");
       }
+    } else if (n >= 4 && strcmp(parts[1], "key") == 0) {
+      auto region = region_map.findByName(parts[2]);
+      if (region == NULL) {
+        strcpy(reply, "Err - not found");
+      } else if (region->name[0] != '$') {
+        strcpy(reply, "Err - not a private region");
+      } else if (strcmp(parts[3], "clear") == 0) {
+        strcpy(reply, key_store.removeKeys(region->id) ? "OK" : "Err - save failed");
+      } else {
+        TransportKey keys[MAX_TKS_KEYS_PER_ID];
+        int num = key_store.loadKeysFor(region->id, keys, MAX_TKS_KEYS_PER_ID);
+        if (num >= MAX_TKS_KEYS_PER_ID) {
+          strcpy(reply, "Err - too many keys");
+        } else if (strlen(parts[3]) != sizeof(keys[0].key)*2 || !mesh::Utils::fromHex(keys[num].key, sizeof(keys[0].key), parts[3])) {
+          strcpy(reply, "Err - bad key");
+        } else if (key_store.saveKeysFor(region->id, keys, num + 1)) {
+          sprintf(reply, "OK - %d key(s)", num + 1);
+        } else {
+          strcpy(reply, "Err - save failed");
+        }
+      }
+    } else if (n == 2 && strcmp(parts[1], "keys") == 0) {
+      sprintf(reply, " cached: %d/%d, hits: %u, misses: %u", key_store.getNumCached(), MAX_TKS_ENTRIES,
+              key_store.getNumCacheHits(), key_store.getNumCacheMisses());
     } else if (n >= 3 && strcmp(parts[1], "list") == 0) {
       uint8_t mask = 0;
       bool invert = false;
@@ -1311,15 +1476,22 @@ void MyMesh::loop() {
     updateAdvertTimer(); // schedule next local advert
   }
 
+  if (millisHasNowPassed(seen_snapshot_at)) {   // keep retained RAM copy fresh, in case of crash/watchdog reset
+    saveSeenTables(false);
+    seen_snapshot_at = futureMillis(SEEN_SNAPSHOT_MILLIS);
+  }
+
   if (set_radio_at && millisHasNowPassed(set_radio_at)) { // apply pending (temporary) radio params
     set_radio_at = 0;                                     // clear timer
     radio_set_params(pending_freq, pending_bw, pending_sf, pending_cr);
+    _radio->onParamsChanged();
     MESH_DEBUG_PRINTLN("Temp radio params");
   }
 
   if (revert_radio_at && millisHasNowPassed(revert_radio_at)) { // revert radio params to orig
     revert_radio_at = 0;                                        // clear timer
     radio_set_params(_prefs.freq, _prefs.bw, _prefs.sf, _prefs.cr);
+    _radio->onParamsChanged();
     MESH_DEBUG_PRINTLN("Radio params restored");
   }
 
@@ -1335,10 +1507,22 @@ void MyMesh::loop() {
   last_millis = now;
 }
 
+unsigned long MyMesh::getNextDeadline() {
+  unsigned long deadline = mesh::Mesh::getNextDeadline();
+
+  if (next_flood_advert) deadline = earliestMillis(deadline, next_flood_advert);
+  if (next_local_advert) deadline = earliestMillis(deadline, next_local_advert);
+  if (set_radio_at) deadline = earliestMillis(deadline, set_radio_at);
+  if (revert_radio_at) deadline = earliestMillis(deadline, revert_radio_at);
+  if (dirty_contacts_expiry) deadline = earliestMillis(deadline, dirty_contacts_expiry);
+
+  return deadline;
+}
+
 // To check if there is pending work
-bool MyMesh::hasPendingWork() const {
+bool MyMesh::hasPendingWork() {
 #if defined(WITH_BRIDGE)
   if (bridge.isRunning()) return true;  // bridge needs WiFi radio, can't sleep
 #endif
-  return _mgr->getOutboundTotal() > 0;
+  return getMillisUntilNextDeadline() == 0;   // something needs doing right now
 }
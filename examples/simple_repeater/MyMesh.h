@@ -29,6 +29,7 @@
 #include <helpers/CommonCLI.h>
 #include <helpers/IdentityStore.h>
 #include <helpers/SimpleMeshTables.h>
+#include <helpers/BloomMeshTables.h>
 #include <helpers/StaticPoolPacketManager.h>
 #include <helpers/StatsFormatHelper.h>
 #include <helpers/TxtDataHelpers.h>
@@ -39,6 +40,36 @@
 extern AbstractBridge* bridge;
 #endif
 
+#ifdef USE_BLOOM_MESH_TABLES
+  typedef BloomMeshTables RepeaterMeshTables;    // low-RAM boards: much wider dedupe window, some false-positives
+#else
+  typedef SimpleMeshTables RepeaterMeshTables;
+#endif
+
+#ifdef USE_SLAB_PACKET_MANAGER
+  // queued packets kept in compact slots: ~6.4KB, vs ~10KB for StaticPoolPacketManager(32), same queue depth
+  #include <helpers/SlabPacketManager.h>
+  #ifndef SLAB_NUM_WORKING
+    #define SLAB_NUM_WORKING    6
+  #endif
+  #ifndef SLAB_NUM_SMALL
+    #define SLAB_NUM_SMALL     12
+  #endif
+  #ifndef SLAB_NUM_MEDIUM
+    #define SLAB_NUM_MEDIUM    12
+  #endif
+  #ifndef SLAB_NUM_LARGE
+    #define SLAB_NUM_LARGE      6
+  #endif
+#endif
+
+#ifndef REPEATER_FLOOD_RETRANSMIT_TTL
+  #define REPEATER_FLOOD_RETRANSMIT_TTL        30000   // millis, queued flood retransmits expire (see Mesh::getRetransmitTTL())
+#endif
+#ifndef REPEATER_TX_DEADLINE_AIRTIME_FACTOR
+  #define REPEATER_TX_DEADLINE_AIRTIME_FACTOR  3       // ACK/PATH/RESPONSE sent earliest-deadline-first (see Mesh::getTxDeadline())
+#endif
+
 struct RepeaterStats {
   uint16_t batt_milli_volts;
   uint16_t curr_tx_queue_len;
@@ -55,6 +86,12 @@ struct RepeaterStats {
   uint16_t n_direct_dups, n_flood_dups;
   uint32_t total_rx_air_time_secs;
   uint32_t n_recv_errors;
+  uint32_t n_tx_queue_full, n_tx_evicted;   // outbound packets dropped: new one (queue full), or displaced by more important one
+  uint32_t n_rx_queue_full, n_pool_empty;
+  uint32_t n_tx_expired;   // queued flood retransmits dropped as stale
+  uint32_t n_tx_suppressed;   // queued flood retransmits cancelled, heard from enough neighbours
+  uint16_t flood_fwd_pct;     // current gossip forward probability (percent)
+  uint16_t flood_fwd_ratio;   // flood packets forwarded / eligible, x 1000
 };
 
 #ifndef MAX_CLIENTS
@@ -79,6 +116,7 @@ struct NeighbourInfo {
 #define FIRMWARE_ROLE "repeater"
 
 #define PACKET_LOG_FILE  "/packet_log"
+#define SEEN_TABLES_FILE "/seen_tables"
 
 class MyMesh : public mesh::Mesh, public CommonCLICallbacks {
   FILESYSTEM* _fs;
@@ -102,6 +140,11 @@ class MyMesh : public mesh::Mesh, public CommonCLICallbacks {
   unsigned long pending_discover_until;
   bool region_load_active;
   unsigned long dirty_contacts_expiry;
+  unsigned long gossip_sample_at;
+  unsigned long seen_snapshot_at;
+  uint32_t gossip_prev_recv, gossip_prev_dups;
+  uint16_t flood_copies_x16;   // smoothed avg copies heard of each flood packet (x 16)
+  uint8_t flood_fwd_pct;
 #if MAX_NEIGHBOURS
   NeighbourInfo neighbours[MAX_NEIGHBOURS];
 #endif
@@ -156,6 +199,19 @@ protected:
   uint8_t getExtraAckTransmitCount() const override {
     return _prefs.multi_acks;
   }
+  uint32_t getFloodRetransmitTTL() const override {
+    return REPEATER_FLOOD_RETRANSMIT_TTL;
+  }
+  uint8_t getTxDeadlineAirtimeFactor() const override {
+    return REPEATER_TX_DEADLINE_AIRTIME_FACTOR;
+  }
+  uint8_t getFloodSuppressThreshold() const override {
+    return _prefs.flood_suppress;
+  }
+  uint8_t getFloodForwardPercent(const mesh::Packet* packet) override;
+  uint8_t getTxClassShare(uint8_t tx_class) const override {
+    return _prefs.airtime_shares[tx_class];
+  }
 
 #if ENV_INCLUDE_GPS == 1
   void applyGpsPrefs() {
@@ -214,8 +270,13 @@ public:
 
   void saveIdentity(const mesh::LocalIdentity& new_id) override;
   void clearStats() override;
+  void onBeforeReboot() override { saveSeenTables(true); }
+  bool hasForwardingPrefs() const override { return true; }
+  void saveSeenTables(bool to_file);
+  void restoreSeenTables();
   void handleCommand(uint32_t sender_timestamp, char* command, char* reply);
   void loop();
+  unsigned long getNextDeadline() override;
 
 #if defined(WITH_BRIDGE)
   void setBridgeState(bool enable) override {
@@ -238,7 +299,7 @@ public:
 #endif
 
   // To check if there is pending work
-  bool hasPendingWork() const;
+  bool hasPendingWork();
 
 #if defined(USE_SX1262) || defined(USE_SX1268)
   void setRxBoostedGain(bool enable) override;
@@ -9,7 +9,7 @@
 #endif
 
 StdRNG fast_rng;
-SimpleMeshTables tables;
+RepeaterMeshTables tables;
 
 MyMesh the_mesh(board, radio_driver, *new ArduinoMillis(), fast_rng, rtc_clock, tables);
 
@@ -23,6 +23,8 @@ static char command[160];
 unsigned long lastActive = 0; // mark last active time
 unsigned long nextSleepinSecs = 120; // next sleep in seconds. The first sleep (if enabled) is after 2 minutes from boot
 
+#define MAX_SLEEP_SECS  1800   // wake up at least every 30 minutes
+
 #if defined(PIN_USER_BTN) && defined(_SEEED_SENSECAP_SOLAR_H_)
 static unsigned long userBtnDownAt = 0;
 #define USER_BTN_HOLD_OFF_MILLIS 1500
@@ -156,14 +158,16 @@ void loop() {
 
   if (the_mesh.getNodePrefs()->powersaving_enabled && !the_mesh.hasPendingWork()) {
     #if defined(NRF52_PLATFORM)
-    board.sleep(1800); // nrf ignores seconds param, sleeps whenever possible
+    board.sleep(MAX_SLEEP_SECS); // nrf ignores seconds param, sleeps whenever possible
     #else
     if (the_mesh.millisHasNowPassed(lastActive + nextSleepinSecs * 1000)) { // To check if it is time to sleep
-      board.sleep(1800);             // To sleep. Wake up after 30 minutes or when receiving a LoRa packet
+      uint32_t secs = the_mesh.getMillisUntilNextDeadline() / 1000;   // sleep until mesh next has work to do
+      if (secs > MAX_SLEEP_SECS) secs = MAX_SLEEP_SECS;
+      if (secs > 0) {
+        board.sleep(secs);             // Wake up at next deadline, or when receiving a LoRa packet
+      }
       lastActive = millis();
-      nextSleepinSecs = 5;  // Default: To work for 5s and sleep again
-    } else {
-      nextSleepinSecs += 5; // When there is pending work, to work another 5s
+      nextSleepinSecs = 0;  // after boot, sleep whenever idle
     }
     #endif
   }
@@ -648,6 +648,7 @@ void MyMesh::begin(FILESYSTEM *fs) {
   acl.load(_fs, self_id);
 
   radio_set_params(_prefs.freq, _prefs.bw, _prefs.sf, _prefs.cr);
+  _radio->onParamsChanged();
   radio_set_tx_power(_prefs.tx_power_dbm);
 
   updateAdvertTimer();
@@ -879,12 +880,14 @@ void MyMesh::loop() {
   if (set_radio_at && millisHasNowPassed(set_radio_at)) { // apply pending (temporary) radio params
     set_radio_at = 0;                                     // clear timer
     radio_set_params(pending_freq, pending_bw, pending_sf, pending_cr);
+    _radio->onParamsChanged();
     MESH_DEBUG_PRINTLN("Temp radio params");
   }
 
   if (revert_radio_at && millisHasNowPassed(revert_radio_at)) { // revert radio params to orig
     revert_radio_at = 0;                                        // clear timer
     radio_set_params(_prefs.freq, _prefs.bw, _prefs.sf, _prefs.cr);
+    _radio->onParamsChanged();
     MESH_DEBUG_PRINTLN("Radio params restored");
   }
 
@@ -901,3 +904,16 @@ void MyMesh::loop() {
   uptime_millis += now - last_millis;
   last_millis = now;
 }
+
+unsigned long MyMesh::getNextDeadline() {
+  unsigned long deadline = mesh::Mesh::getNextDeadline();
+
+  if (acl.getNumClients() > 0) deadline = earliestMillis(deadline, next_push);
+  if (next_flood_advert) deadline = earliestMillis(deadline, next_flood_advert);
+  if (next_local_advert) deadline = earliestMillis(deadline, next_local_advert);
+  if (set_radio_at) deadline = earliestMillis(deadline, set_radio_at);
+  if (revert_radio_at) deadline = earliestMillis(deadline, revert_radio_at);
+  if (dirty_contacts_expiry) deadline = earliestMillis(deadline, dirty_contacts_expiry);
+
+  return deadline;
+}
@@ -205,4 +205,5 @@ public:
   void clearStats() override;
   void handleCommand(uint32_t sender_timestamp, char* command, char* reply);
   void loop();
+  unsigned long getNextDeadline() override;
 };
@@ -578,6 +578,7 @@ void setup() {
 #endif
 
   radio_set_params(the_mesh.getFreqPref(), LORA_BW, LORA_SF, LORA_CR);
+  radio_driver.onParamsChanged();
   radio_set_tx_power(the_mesh.getTxPowerPref());
 
   the_mesh.showWelcome();
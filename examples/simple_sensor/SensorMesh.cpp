@@ -740,6 +740,7 @@ void SensorMesh::begin(FILESYSTEM* fs) {
   acl.load(_fs, self_id);
 
   radio_set_params(_prefs.freq, _prefs.bw, _prefs.sf, _prefs.cr);
+  _radio->onParamsChanged();
   radio_set_tx_power(_prefs.tx_power_dbm);
 
   updateAdvertTimer();
@@ -884,12 +885,14 @@ void SensorMesh::loop() {
   if (set_radio_at && millisHasNowPassed(set_radio_at)) {   // apply pending (temporary) radio params
     set_radio_at = 0;  // clear timer
     radio_set_params(pending_freq, pending_bw, pending_sf, pending_cr);
+    _radio->onParamsChanged();
     MESH_DEBUG_PRINTLN("Temp radio params");
   }
 
   if (revert_radio_at && millisHasNowPassed(revert_radio_at)) {   // revert radio params to orig
     revert_radio_at = 0;  // clear timer
     radio_set_params(_prefs.freq, _prefs.bw, _prefs.sf, _prefs.cr);
+    _radio->onParamsChanged();
     MESH_DEBUG_PRINTLN("Radio params restored");
   }
 
@@ -0,0 +1,175 @@
+#include "ed_25519.h"
+#include "sha512.h"
+#include "ge.h"
+#include "sc.h"
+
+#define BATCH_WINDOW_BOUND 7   /* 4 bit windows, so tables of 4 odd multiples */
+
+typedef char batch_entry_size_check[sizeof(((ed25519_batch_entry *) 0)->Ai) == 4 * sizeof(ge_cached) ? 1 : -1];
+
+/*
+Checks  8 * sum(z_i * (s_i*B - h_i*A_i - R_i)) == 0  for random 128 bit z_i, ie. all the signatures at once, with one
+shared run of 256 doublings (Straus' method, with sum(z_i*s_i)*B added in the same run). Returns 1 if they all pass.
+The check is cofactored (the 8*), so a signature is accepted regardless of any small-order component in R or A. Without
+it, such a signature (which only the key's owner can make) would pass or fail depending on the z_i.
+*/
+static int batch_check(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, size_t count, const unsigned char *random, ed25519_batch_entry *work) {
+    const unsigned char zero[32] = {0};
+    unsigned char seed[64];
+    unsigned char sum_s[32];
+    unsigned char idx[2];
+    sha512_context hash;
+    signed char sslide[256];
+    ge_p3 A, R;
+    ge_p2 r;
+    ge_p1p1 t;
+    ge_p3 u;
+    size_t j;
+    int i, top;
+
+    /* z_i are derived from 'random' and all the signatures, so can't be predicted by whoever made them */
+    if (count > 1) {
+        sha512_init(&hash);
+        sha512_update(&hash, random, 16);
+        for (j = 0; j < count; ++j) {
+            sha512_update(&hash, signatures[j], 64);
+            sha512_update(&hash, public_keys[j], 32);
+        }
+        sha512_final(&hash, seed);
+    }
+
+    for (i = 0; i < 32; ++i) {
+        sum_s[i] = 0;
+    }
+
+    top = -1;
+    for (j = 0; j < count; ++j) {
+        ed25519_batch_entry *e = &work[j];
+        unsigned char h[64];
+        unsigned char z[64];
+        unsigned char zh[32];
+
+        if ((signatures[j][63] & 224) || ge_frombytes_negate_vartime(&A, public_keys[j]) != 0 || ge_frombytes_negate_vartime(&R, signatures[j]) != 0) {
+            return 0;
+        }
+
+        sha512_init(&hash);
+        sha512_update(&hash, signatures[j], 32);
+        sha512_update(&hash, public_keys[j], 32);
+        sha512_update(&hash, messages[j], message_lens[j]);
+        sha512_final(&hash, h);
+        sc_reduce(h);
+
+        if (count == 1) {
+            z[0] = 1;   /* nothing to combine with, so no need for a random z */
+            for (i = 1; i < 32; ++i) {
+                z[i] = 0;
+            }
+        } else {
+            sha512_init(&hash);
+            sha512_update(&hash, seed, 64);
+            idx[0] = (unsigned char) j;
+            idx[1] = (unsigned char) (j >> 8);
+            sha512_update(&hash, idx, 2);
+            sha512_final(&hash, z);
+            for (i = 16; i < 32; ++i) {
+                z[i] = 0;
+            }
+        }
+
+        sc_muladd(zh, z, h, zero);
+        sc_muladd(sum_s, z, signatures[j] + 32, sum_s);
+
+        ge_precompute_multiples((ge_cached *) e->Ai, &A, 4);
+        ge_precompute_multiples((ge_cached *) e->Ri, &R, 4);
+        ge_slide(e->aslide, zh, BATCH_WINDOW_BOUND);
+        ge_slide(e->rslide, z, BATCH_WINDOW_BOUND);
+
+        for (i = 255; i > top; --i) {
+            if (e->aslide[i] || e->rslide[i]) {
+                top = i;
+            }
+        }
+    }
+
+    ge_slide(sslide, sum_s, 15);
+    for (i = 255; i > top; --i) {
+        if (sslide[i]) {
+            top = i;
+        }
+    }
+
+    /* r = sum(z_i*s_i)*B + sum(z_i*h_i * -A_i + z_i * -R_i) */
+    ge_p2_0(&r);
+    for (i = top; i >= 0; --i) {
+        ge_p2_dbl(&t, &r);
+
+        for (j = 0; j < count; ++j) {
+            const ed25519_batch_entry *e = &work[j];
+            const ge_cached *Ai = (const ge_cached *) e->Ai;
+            const ge_cached *Ri = (const ge_cached *) e->Ri;
+
+            if (e->aslide[i] > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_add(&t, &u, &Ai[e->aslide[i] / 2]);
+            } else if (e->aslide[i] < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_sub(&t, &u, &Ai[(-e->aslide[i]) / 2]);
+            }
+
+            if (e->rslide[i] > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_add(&t, &u, &Ri[e->rslide[i] / 2]);
+            } else if (e->rslide[i] < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_sub(&t, &u, &Ri[(-e->rslide[i]) / 2]);
+            }
+        }
+
+        if (sslide[i]) {
+            ge_p1p1_to_p3(&u, &t);
+            ge_madd_base_multiple(&t, &u, sslide[i]);
+        }
+
+        ge_p1p1_to_p2(&r, &t);
+    }
+
+    /* 8*r must be the identity, ie. X == 0 and Y == Z */
+    for (i = 0; i < 3; ++i) {
+        ge_p2_dbl(&t, &r);
+        ge_p1p1_to_p2(&r, &t);
+    }
+
+    fe_sub(r.Y, r.Y, r.Z);
+    return !fe_isnonzero(r.X) && !fe_isnonzero(r.Y);
+}
+
+/*
+Verifies the signatures together (see batch_check() above), with 'random' as 16 unpredictable bytes. A bad signature
+only passes with probability about 2^-128.
+If the batch fails, each signature is checked as a batch of one, to find the bad one(s). So the results are those of a
+cofactored verify, whatever the batch. They match ed25519_verify() (and the Crypto library's Ed25519::verify()) except
+for signatures with a small-order component, which those reject.
+valid[i] is set to 1 or 0, and the number of valid signatures is returned.
+*/
+int ed25519_verify_batch(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, size_t count, const unsigned char *random, ed25519_batch_entry *work, int *valid) {
+    size_t j;
+    int num_valid = 0;
+
+    if (count == 0) {
+        return 0;
+    }
+
+    if (count > 1 && batch_check(signatures, messages, message_lens, public_keys, count, random, work)) {
+        for (j = 0; j < count; ++j) {
+            valid[j] = 1;
+        }
+        return (int) count;
+    }
+
+    for (j = 0; j < count; ++j) {
+        valid[j] = batch_check(&signatures[j], &messages[j], &message_lens[j], &public_keys[j], 1, random, work);
+        num_valid += valid[j];
+    }
+    return num_valid;
+}
@@ -4,6 +4,7 @@
 // Nightcracker's Ed25519 -  https://github.com/orlp/ed25519
 
 #include <stddef.h>
+#include "fixedint.h"
 
 #if defined(_WIN32)
     #if defined(ED25519_BUILD_DLL)
@@ -22,6 +23,20 @@
 extern "C" {
 #endif
 
+#ifdef ED25519_FE32
+    #define ED25519_FE_WORDS 8     /* words in a field element (see fe.h) */
+#else
+    #define ED25519_FE_WORDS 10
+#endif
+
+/* workspace for one signature of ed25519_verify_batch() */
+typedef struct {
+    int32_t Ai[4][4][ED25519_FE_WORDS];   /* -A,-3A,-5A,-7A (as ge_cached) */
+    int32_t Ri[4][4][ED25519_FE_WORDS];   /* -R,.. */
+    signed char aslide[256];
+    signed char rslide[256];
+} ed25519_batch_entry;
+
 #ifndef ED25519_NO_SEED
 int ED25519_DECLSPEC ed25519_create_seed(unsigned char *seed);
 #endif
@@ -30,6 +45,7 @@ void ED25519_DECLSPEC ed25519_create_keypair(unsigned char *public_key, unsigned
 void ED25519_DECLSPEC ed25519_derive_pub(unsigned char *public_key, const unsigned char *private_key);
 void ED25519_DECLSPEC ed25519_sign(unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const unsigned char *private_key);
 int ED25519_DECLSPEC ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key);
+int ED25519_DECLSPEC ed25519_verify_batch(const unsigned char *const *signatures, const unsigned char *const *messages, const size_t *message_lens, const unsigned char *const *public_keys, size_t count, const unsigned char *random, ed25519_batch_entry *work, int *valid);
 void ED25519_DECLSPEC ed25519_add_scalar(unsigned char *public_key, unsigned char *private_key, const unsigned char *scalar);
 void ED25519_DECLSPEC ed25519_key_exchange(unsigned char *shared_secret, const unsigned char *public_key, const unsigned char *private_key);
 
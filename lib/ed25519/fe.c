@@ -1,6 +1,11 @@
 #include "fixedint.h"
 #include "fe.h"
 
+/*
+    fe_invert() and fe_pow22523() are shared with the radix 2^32 backend (fe_32.c), the rest is ref10's radix 2^25.5
+*/
+#ifndef ED25519_FE32
+
 
 /*
     helper functions
@@ -361,6 +366,9 @@ void fe_frombytes(fe h, const unsigned char *s) {
 
 
 
+#endif  /* !ED25519_FE32 */
+
+
 void fe_invert(fe out, const fe z) {
     fe t0;
     fe t1;
@@ -448,6 +456,9 @@ void fe_invert(fe out, const fe z) {
 }
 
 
+#ifndef ED25519_FE32
+
+
 
 /*
     return 1 if f is in {1,3,5,...,q-2}
@@ -878,6 +889,9 @@ void fe_neg(fe h, const fe f) {
 }
 
 
+#endif  /* !ED25519_FE32 */
+
+
 void fe_pow22523(fe out, const fe z) {
     fe t0;
     fe t1;
@@ -964,6 +978,9 @@ void fe_pow22523(fe out, const fe z) {
 }
 
 
+#ifndef ED25519_FE32
+
+
 /*
 h = f * f
 Can overlap h with f.
@@ -1489,3 +1506,5 @@ void fe_tobytes(unsigned char *s, const fe h) {
     s[30] = (unsigned char) (h9 >> 10);
     s[31] = (unsigned char) (h9 >> 18);
 }
+
+#endif  /* !ED25519_FE32 */
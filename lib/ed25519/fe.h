@@ -13,7 +13,14 @@
 */
 
 
+#ifdef ED25519_FE32
+/*
+    Alternative backend for 32-bit cores (see fe_32.c): 8 x 32 bit words, radix 2^32.
+*/
+typedef uint32_t fe[8];
+#else
 typedef int32_t fe[10];
+#endif
 
 
 void fe_0(fe h);
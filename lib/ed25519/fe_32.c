@@ -0,0 +1,375 @@
+#include "fixedint.h"
+#include "fe.h"
+
+#ifdef ED25519_FE32
+
+/*
+    Field arithmetic for 32-bit cores (Cortex-M4, ESP32, RP2040), selected with ED25519_FE32.
+    An element is 8 x 32 bit words (radix 2^32), little-endian, and is kept < 2^256 but only fully reduced
+    (mod p = 2^255-19) by fe_tobytes(). As 2^256 = 38 (mod p), a carry out of the top word is folded back in as
+    38 * carry. Products are 32x32->64 multiply-accumulates, where a*b + c + d always fits in 64 bits (eg. UMAAL),
+    so fe_mul is 64 of these (vs 100 in ref10's radix 2^25.5), and fe_sq is 36.
+    Bit-for-bit compatible with fe.c, as seen through fe_tobytes() etc.
+*/
+
+static const fe fe_zero = {0};
+
+
+/*
+h += 38 * carry, where carry < 2^26
+*/
+
+static void fe_fold(fe h, uint32_t carry) {
+    uint64_t t = (uint64_t) h[0] + (uint64_t) carry * 38;
+    int i;
+
+    h[0] = (uint32_t) t;
+    t >>= 32;
+
+    for (i = 1; i < 8; ++i) {
+        t += h[i];
+        h[i] = (uint32_t) t;
+        t >>= 32;
+    }
+
+    /* only carries out again if h wrapped, in which case h is now < 38 * carry, so this can't carry */
+    h[0] += (uint32_t) t * 38;
+}
+
+
+/*
+h = r mod p, where r is 16 words (ie. a full product)
+*/
+
+static void fe_reduce(fe h, const uint32_t *r) {
+    uint64_t t = 0;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        t += (uint64_t) r[i] + (uint64_t) r[i + 8] * 38;
+        h[i] = (uint32_t) t;
+        t >>= 32;
+    }
+
+    fe_fold(h, (uint32_t) t);
+}
+
+
+void fe_0(fe h) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        h[i] = 0;
+    }
+}
+
+
+void fe_1(fe h) {
+    fe_0(h);
+    h[0] = 1;
+}
+
+
+void fe_copy(fe h, const fe f) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        h[i] = f[i];
+    }
+}
+
+
+/*
+h = f + g
+Can overlap h with f or g.
+*/
+
+void fe_add(fe h, const fe f, const fe g) {
+    uint64_t t = 0;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        t += (uint64_t) f[i] + g[i];
+        h[i] = (uint32_t) t;
+        t >>= 32;
+    }
+
+    fe_fold(h, (uint32_t) t);
+}
+
+
+/*
+h = f - g
+Can overlap h with f or g.
+*/
+
+void fe_sub(fe h, const fe f, const fe g) {
+    int64_t t = 0;
+    uint32_t borrow;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        t += (int64_t) f[i] - g[i];
+        h[i] = (uint32_t) t;
+        t >>= 32;   /* 0, or -1 if borrowed */
+    }
+
+    /* borrowed 2^256, ie. h is 38 too big, so subtract 38 */
+    borrow = (uint32_t) -t;
+    t = (int64_t) h[0] - (int64_t) borrow * 38;
+    h[0] = (uint32_t) t;
+    t >>= 32;
+
+    for (i = 1; i < 8; ++i) {
+        t += h[i];
+        h[i] = (uint32_t) t;
+        t >>= 32;
+    }
+
+    /* borrows again only if h was < 38, in which case h[0] is now > 2^32 - 38, so this can't borrow */
+    h[0] -= (uint32_t) -t * 38;
+}
+
+
+/*
+h = -f
+*/
+
+void fe_neg(fe h, const fe f) {
+    fe_sub(h, fe_zero, f);
+}
+
+
+/*
+Replace (f,g) with (g,g) if b == 1;
+replace (f,g) with (f,g) if b == 0.
+
+Preconditions: b in {0,1}.
+*/
+
+void fe_cmov(fe f, const fe g, unsigned int b) {
+    uint32_t mask = (uint32_t) -(int32_t) b;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        f[i] ^= mask & (f[i] ^ g[i]);
+    }
+}
+
+
+/*
+Replace (f,g) with (g,f) if b == 1;
+replace (f,g) with (f,g) if b == 0.
+
+Preconditions: b in {0,1}.
+*/
+
+void fe_cswap(fe f, fe g, unsigned int b) {
+    uint32_t mask = (uint32_t) -(int32_t) b;
+    uint32_t x;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        x = mask & (f[i] ^ g[i]);
+        f[i] ^= x;
+        g[i] ^= x;
+    }
+}
+
+
+/*
+Ignores top bit of s, as per fe.c
+*/
+
+void fe_frombytes(fe h, const unsigned char *s) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        h[i] = (uint32_t) s[4 * i] | ((uint32_t) s[4 * i + 1] << 8) | ((uint32_t) s[4 * i + 2] << 16) | ((uint32_t) s[4 * i + 3] << 24);
+    }
+
+    h[7] &= 0x7fffffff;
+}
+
+
+/*
+s = h, fully reduced mod p
+*/
+
+void fe_tobytes(unsigned char *s, const fe h) {
+    uint32_t t[8];
+    uint32_t u[8];
+    uint32_t mask;
+    uint64_t c;
+    int i, k;
+
+    fe_copy(t, h);
+
+    /* fold bit 255 back in as 19 (2^255 = 19 mod p), twice, so t < 2^255 */
+    for (k = 0; k < 2; ++k) {
+        c = (uint64_t) (t[7] >> 31) * 19;
+        t[7] &= 0x7fffffff;
+
+        for (i = 0; i < 8; ++i) {
+            c += t[i];
+            t[i] = (uint32_t) c;
+            c >>= 32;
+        }
+    }
+
+    /* t - p = t + 19 - 2^255, so use that if t + 19 reaches bit 255 */
+    c = 19;
+    for (i = 0; i < 8; ++i) {
+        c += t[i];
+        u[i] = (uint32_t) c;
+        c >>= 32;
+    }
+
+    mask = (uint32_t) -(int32_t) (u[7] >> 31);
+    u[7] &= 0x7fffffff;
+
+    for (i = 0; i < 8; ++i) {
+        t[i] ^= mask & (t[i] ^ u[i]);
+        s[4 * i] = (unsigned char) t[i];
+        s[4 * i + 1] = (unsigned char) (t[i] >> 8);
+        s[4 * i + 2] = (unsigned char) (t[i] >> 16);
+        s[4 * i + 3] = (unsigned char) (t[i] >> 24);
+    }
+}
+
+
+int fe_isnegative(const fe f) {
+    unsigned char s[32];
+
+    fe_tobytes(s, f);
+
+    return s[0] & 1;
+}
+
+
+int fe_isnonzero(const fe f) {
+    unsigned char s[32];
+    unsigned char r = 0;
+    int i;
+
+    fe_tobytes(s, f);
+
+    for (i = 0; i < 32; ++i) {
+        r |= s[i];
+    }
+
+    return r != 0;
+}
+
+
+/*
+h = f * g
+Can overlap h with f or g.
+*/
+
+void fe_mul(fe h, const fe f, const fe g) {
+    uint32_t r[16];
+    uint64_t t;
+    uint32_t c;
+    int i, j;
+
+    for (i = 0; i < 16; ++i) {
+        r[i] = 0;
+    }
+
+    for (i = 0; i < 8; ++i) {
+        c = 0;
+
+        for (j = 0; j < 8; ++j) {
+            t = (uint64_t) f[i] * g[j] + r[i + j] + c;   /* can't overflow: (2^32-1)^2 + 2*(2^32-1) = 2^64-1 */
+            r[i + j] = (uint32_t) t;
+            c = (uint32_t) (t >> 32);
+        }
+
+        r[i + 8] = c;
+    }
+
+    fe_reduce(h, r);
+}
+
+
+/*
+h = f * f
+Can overlap h with f.
+*/
+
+void fe_sq(fe h, const fe f) {
+    uint32_t r[16];
+    uint64_t t;
+    uint32_t c;
+    int i, j;
+
+    for (i = 0; i < 16; ++i) {
+        r[i] = 0;
+    }
+
+    /* cross products f[i]*f[j], i < j */
+    for (i = 0; i < 7; ++i) {
+        c = 0;
+
+        for (j = i + 1; j < 8; ++j) {
+            t = (uint64_t) f[i] * f[j] + r[i + j] + c;
+            r[i + j] = (uint32_t) t;
+            c = (uint32_t) (t >> 32);
+        }
+
+        r[i + 8] = c;
+    }
+
+    /* double them */
+    c = 0;
+    for (i = 0; i < 16; ++i) {
+        uint32_t top = r[i] >> 31;
+        r[i] = (r[i] << 1) | c;
+        c = top;
+    }
+
+    /* add the squares f[i]*f[i] */
+    c = 0;
+    for (i = 0; i < 8; ++i) {
+        t = (uint64_t) f[i] * f[i] + r[2 * i] + c;
+        r[2 * i] = (uint32_t) t;
+        t = (t >> 32) + r[2 * i + 1];
+        r[2 * i + 1] = (uint32_t) t;
+        c = (uint32_t) (t >> 32);
+    }
+
+    fe_reduce(h, r);
+}
+
+
+/*
+h = 2 * f * f
+Can overlap h with f.
+*/
+
+void fe_sq2(fe h, const fe f) {
+    fe_sq(h, f);
+    fe_add(h, h, h);
+}
+
+
+/*
+h = f * 121666
+Can overlap h with f.
+*/
+
+void fe_mul121666(fe h, fe f) {
+    uint64_t t = 0;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        t += (uint64_t) f[i] * 121666;
+        h[i] = (uint32_t) t;
+        t >>= 32;
+    }
+
+    fe_fold(h, (uint32_t) t);
+}
+
+#endif
@@ -58,7 +58,10 @@ int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s);
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b);
+void ge_precompute_multiples(ge_cached *Ai, const ge_p3 *A, int n);
+void ge_slide(signed char *r, const unsigned char *a, int bound);
 void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
+void ge_madd_base_multiple(ge_p1p1 *r, const ge_p3 *p, signed char b);
 void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_scalarmult_base(ge_p3 *h, const unsigned char *a);
 
@@ -0,0 +1,1393 @@
+/* precomp_data.h, converted to the radix 2^32 field elements of fe_32.c (ED25519_FE32) */
+
+static const ge_precomp Bi[8] = {
+    {
+        { 0xf58c3b85, 0x2fbc93c6, 0xfb8c0e19, 0xcf932dc6, 0x643d42c2, 0x270b4898, 0x33d4ba65, 0x07cf9d3a },
+        { 0xd740913e, 0x9d103905, 0xd140beb3, 0xfd399f05, 0x688f8a09, 0xa5c18434, 0x98f81267, 0x44fd2f92 },
+        { 0x877aaa68, 0xabc91205, 0xccaac49e, 0x26d9e823, 0xdd43598c, 0x5a1b7dcb, 0x9f0c65a8, 0x6f117b68 },
+    },
+    {
+        { 0x4cee9730, 0xaf25b0a8, 0xe8864b8a, 0x025a8430, 0x9f016732, 0xc11b5002, 0x9a80f8f4, 0x7a164e1b },
+        { 0xa4fcd265, 0x56611fe8, 0xe5c1ba7d, 0x3bd353fd, 0x214bd6bd, 0x8131f31a, 0x555bda62, 0x2ab91587 },
+        { 0x0dd0d889, 0x14ae933f, 0x1c35da62, 0x58942322, 0x8cf2db4c, 0xd170e545, 0x12b9b4c6, 0x5a2826af },
+    },
+    {
+        { 0x08a5bb33, 0xa212bc44, 0xc75eed02, 0x8d5048c3, 0x5abfec44, 0xdd1beb0c, 0x46e206eb, 0x2945ccf1 },
+        { 0xa447d6ba, 0x7f9182c3, 0x4b2729b7, 0xd50014d1, 0xb864a087, 0xe33cf11c, 0xeb1b55f3, 0x154a7e73 },
+        { 0x812a8285, 0xbcbbdbf1, 0xd0bdd1fc, 0x270e0807, 0x1bbda72d, 0xb41b670b, 0x6b3bb69a, 0x43aabe69 },
+    },
+    {
+        { 0x944ea3bf, 0x6b1a5cd0, 0xb39dc0d2, 0x7470353a, 0x28542e49, 0x71b25282, 0x283c927e, 0x461bea69 },
+        { 0xaa3221b1, 0xba6f2c9a, 0x3bba23a7, 0x6ca02153, 0x92192c3a, 0x9dea764f, 0x2e5317e0, 0x1d6edd5d },
+        { 0x01b8b3a2, 0xf1836dc8, 0x053ea49a, 0xb3035f47, 0x5877adf3, 0x529c41ba, 0x6a0f90a7, 0x7a9fbb1c },
+    },
+    {
+        { 0xa6a8632f, 0x9b2e678a, 0x51bc46c5, 0xa6509e6f, 0xc686f5b5, 0xceb233c9, 0x8add7f59, 0x34b9ed33 },
+        { 0x039d8064, 0xf36e217e, 0xf520419b, 0x98a081b6, 0xe75eb044, 0x96cbc608, 0xfadc9c8f, 0x49c05a51 },
+        { 0x9045af1b, 0x06b4e8bf, 0xa719d22f, 0xe2ff83e8, 0x93d4cf16, 0xaaf6fc29, 0x1b008b06, 0x73c17202 },
+    },
+    {
+        { 0x8a802ade, 0x2fbf0084, 0x02302e27, 0xe5d9fecf, 0x17703406, 0x113e8471, 0x546d8faf, 0x4275aae2 },
+        { 0x49864348, 0x315f5b02, 0x77088381, 0x3ed6b369, 0x6a8deb95, 0xa3a07555, 0x29d5c77f, 0x18ab5980 },
+        { 0xfd6089e9, 0xd82b2cc5, 0x3282e4a4, 0x031eb4a1, 0xb51a8622, 0x44311199, 0xb53df948, 0x3dc65522 },
+    },
+    {
+        { 0xa2007f6d, 0xbf70c222, 0xb5bcdedb, 0xbf84b39a, 0xfb07ba07, 0x537a0e12, 0xc346f241, 0x234fd7ee },
+        { 0x327fbf93, 0x506f013b, 0x9b776f6b, 0xaefcebc9, 0xaaad5968, 0x9d12b232, 0x176024a7, 0x0267882d },
+        { 0x732ea378, 0x5360a119, 0xdf8dd471, 0x2437e6b1, 0x91a7e533, 0xa2ef37f8, 0xaa097863, 0x497ba6fd },
+    },
+    {
+        { 0x13cfeaa0, 0x24cecc03, 0x189c246d, 0x8648c28d, 0xc1f2d4d0, 0x2dbdbdfa, 0xf12de72b, 0x61e22917 },
+        { 0x468ccf0b, 0x040bcd86, 0x2a9910d6, 0xd3829ba4, 0x07b25192, 0x75083008, 0x18d05ebf, 0x43b5cd42 },
+        { 0x9bd0b516, 0x5d9a762f, 0x373fdeee, 0xeb38af4e, 0x93d64270, 0x032e5a7d, 0x0ae4d842, 0x511d6121 },
+    },
+};
+
+
+/* base[i][j] = (j+1)*256^i*B */
+static const ge_precomp base[32][8] = {
+    {
+        {
+            { 0xf58c3b85, 0x2fbc93c6, 0xfb8c0e19, 0xcf932dc6, 0x643d42c2, 0x270b4898, 0x33d4ba65, 0x07cf9d3a },
+            { 0xd740913e, 0x9d103905, 0xd140beb3, 0xfd399f05, 0x688f8a09, 0xa5c18434, 0x98f81267, 0x44fd2f92 },
+            { 0x877aaa68, 0xabc91205, 0xccaac49e, 0x26d9e823, 0xdd43598c, 0x5a1b7dcb, 0x9f0c65a8, 0x6f117b68 },
+        },
+        {
+            { 0x933c71d7, 0x9224e7fc, 0x7a0ff5b5, 0x9f469d96, 0xe1d60702, 0x5aa69a65, 0xa87d2e2e, 0x590c063f },
+            { 0x42b4d5a8, 0x8a99a560, 0x4e60acf6, 0x8f2b810c, 0xb16e37aa, 0xe09e236b, 0x69c92555, 0x6bb595a6 },
+            { 0xa59b7a5f, 0x43faa8b3, 0x5d9acf78, 0x36c16bdd, 0x0b3d6a31, 0x500fa084, 0x3ea50b73, 0x701af5b1 },
+        },
+        {
+            { 0x4cee9730, 0xaf25b0a8, 0xe8864b8a, 0x025a8430, 0x9f016732, 0xc11b5002, 0x9a80f8f4, 0x7a164e1b },
+            { 0xa4fcd265, 0x56611fe8, 0xe5c1ba7d, 0x3bd353fd, 0x214bd6bd, 0x8131f31a, 0x555bda62, 0x2ab91587 },
+            { 0x0dd0d889, 0x14ae933f, 0x1c35da62, 0x58942322, 0x8cf2db4c, 0xd170e545, 0x12b9b4c6, 0x5a2826af },
+        },
+        {
+            { 0x8efc099f, 0x287351b9, 0x7dfd2538, 0x6765c6f4, 0xfb0a9265, 0xca348d3d, 0x21e58727, 0x680e9103 },
+            { 0x056818bf, 0x95fe050a, 0x5660faa9, 0x327e8971, 0x06a05073, 0xc3e8e3cd, 0x7445a49a, 0x27933f4c },
+            { 0xc476ff09, 0x5a13fbe9, 0x7b5cc172, 0x6e9e3945, 0x102b4494, 0x5ddbdcf9, 0x63553e2b, 0x7f9d0cbf },
+        },
+        {
+            { 0x08a5bb33, 0xa212bc44, 0xc75eed02, 0x8d5048c3, 0x5abfec44, 0xdd1beb0c, 0x46e206eb, 0x2945ccf1 },
+            { 0xa447d6ba, 0x7f9182c3, 0x4b2729b7, 0xd50014d1, 0xb864a087, 0xe33cf11c, 0xeb1b55f3, 0x154a7e73 },
+            { 0x812a8285, 0xbcbbdbf1, 0xd0bdd1fc, 0x270e0807, 0x1bbda72d, 0xb41b670b, 0x6b3bb69a, 0x43aabe69 },
+        },
+        {
+            { 0x77157131, 0x3a0ceeeb, 0x00c8af88, 0x9b271589, 0xda59a736, 0x8065b668, 0xa2cc38bd, 0x51e57bb6 },
+            { 0x7b7d8ca4, 0x499806b6, 0x27d22739, 0x575be284, 0x204553b9, 0xbb085ce7, 0xae417884, 0x38b64c41 },
+            { 0x02ea4b71, 0x85ac3267, 0x41a1bb01, 0xbe70e003, 0x083bc144, 0x53e4a24b, 0x9f0d61e3, 0x10b8e91a },
+        },
+        {
+            { 0x944ea3bf, 0x6b1a5cd0, 0xb39dc0d2, 0x7470353a, 0x28542e49, 0x71b25282, 0x283c927e, 0x461bea69 },
+            { 0xaa3221b1, 0xba6f2c9a, 0x3bba23a7, 0x6ca02153, 0x92192c3a, 0x9dea764f, 0x2e5317e0, 0x1d6edd5d },
+            { 0x01b8b3a2, 0xf1836dc8, 0x053ea49a, 0xb3035f47, 0x5877adf3, 0x529c41ba, 0x6a0f90a7, 0x7a9fbb1c },
+        },
+        {
+            { 0x04dd3e8f, 0x59b75966, 0xe288702c, 0x6cb30377, 0x5ed9c323, 0xb1339c66, 0x61bce52f, 0x0915e760 },
+            { 0xf39234d9, 0xe2a75ded, 0xe1b558f9, 0x963d7680, 0x6e3c23fb, 0x2c2741ac, 0x320e01c3, 0x3a9024a1 },
+            { 0xc9a2911a, 0xe7c1f5d9, 0x8bcca7d7, 0xb8a37178, 0x0eb62a32, 0x63641219, 0x2ecc4e95, 0x26907c5c },
+        },
+    },
+    {
+        {
+            { 0x632f9c1d, 0x2eccdd0e, 0x76893115, 0x51d0b696, 0xa8637a58, 0x52dfb76b, 0xa00eef39, 0x6dd37d49 },
+            { 0x49aa515e, 0xed5b6354, 0x0bc6823a, 0xa865c49f, 0x5b42d1c4, 0x850c1fe9, 0x03d315b9, 0x30d76d6f },
+            { 0x2106e4c7, 0x6c444417, 0x928d7f69, 0xfb53d680, 0x694d3f26, 0xb4739ea4, 0x2e864bb0, 0x10c69711 },
+        },
+        {
+            { 0x8358c805, 0x0ca62aa0, 0x7a204247, 0x6a3d4ae3, 0x3b11eddc, 0x7464d3a6, 0x550806ef, 0x03bf9baf },
+            { 0x7dbe5fde, 0x6493c427, 0x19ad7ea2, 0x265d4fad, 0x46304590, 0x0e00dfc8, 0xed66fe09, 0x25e61cab },
+            { 0xcc586604, 0x3f13e128, 0xb459747e, 0x6f5873ec, 0xcc1268f5, 0xa0b63ded, 0x4586e22c, 0x566d7863 },
+        },
+        {
+            { 0xc65a2fd0, 0xa1054285, 0xf31667c3, 0x6c64112a, 0x731aee58, 0x680ae240, 0x4793b22a, 0x14fba5f3 },
+            { 0x9cc10834, 0x1637a49f, 0xa89bc451, 0xbc8e56d5, 0x7f7fd2db, 0x1cb5ec0f, 0x5ecc35d9, 0x33975bca },
+            { 0x6985f7d4, 0x3cd74616, 0xc9c80057, 0x593e5e84, 0x7b61131e, 0x2fc3f2b6, 0x83fc526c, 0x14829cea },
+        },
+        {
+            { 0x4e71ecb8, 0x21e70b2f, 0x40a477e3, 0xe656ddb9, 0xce1d4f80, 0xbf6556ce, 0x535d7b7e, 0x05fc3bc4 },
+            { 0x97dd95c2, 0xff437b84, 0xaa4eb5a7, 0x6c744e30, 0x3c85e88b, 0x9e0c5d61, 0x5f758173, 0x2fd9c71e },
+            { 0x52afdedd, 0x24b8b3ae, 0xed3b30cf, 0x3495638c, 0xa9be8195, 0x33a4bc83, 0x5c651f04, 0x37376747 },
+        },
+        {
+            { 0x14246590, 0x634095cb, 0x16c15535, 0xef121440, 0x8910bc60, 0x9e38140c, 0x30907c8c, 0x6bf59057 },
+            { 0x40d1add9, 0x2fba99fd, 0x96f4d027, 0xb307166f, 0x15f03bae, 0x4363f052, 0x3b18f999, 0x1fbea56c },
+            { 0xe1415b8a, 0x0fa778f1, 0xbac3a77e, 0x06409ff7, 0x9aa29a50, 0x6f52d7b8, 0x7a635a56, 0x02521cf6 },
+        },
+        {
+            { 0x772f5ee4, 0xb1146720, 0x96079ace, 0xe8f894b1, 0x00ac824a, 0x4af8224d, 0xf7cd6cc4, 0x001753d9 },
+            { 0x0a9d5294, 0x513fee0b, 0x0fdf5a66, 0x8f98e75c, 0xbfe107ce, 0xd4618688, 0x71382ced, 0x3fa00a7e },
+            { 0x963ddb34, 0x3c69232d, 0xb4973858, 0x1dde87da, 0xa091f285, 0xaad7d1f9, 0xa048edb6, 0x12b5fe2f },
+        },
+        {
+            { 0xad6f1e92, 0xdf2b7c26, 0x504b8913, 0x4b66d323, 0x751c8bc3, 0x8c409dc0, 0x0796c7b8, 0x6f7e93c2 },
+            { 0x96fce34d, 0x71f0fbc4, 0xadf35bed, 0x73b9826b, 0xff28c561, 0xd2047261, 0x6fb1206f, 0x749b76f9 },
+            { 0xaea6ae05, 0x1f5af604, 0xbee49c99, 0xc12351f1, 0xeeff6b66, 0x61a808b5, 0x01e02151, 0x0fcec10f },
+        },
+        {
+            { 0xc4244e45, 0x3df2d29d, 0x93d8de0a, 0x2b020e74, 0x820c214d, 0x6cc8067e, 0x6feab90a, 0x41377916 },
+            { 0x49fe1e44, 0x644d58a6, 0x31ad777e, 0x21fcaea2, 0x887fd0d2, 0x02441c5a, 0x83c511f3, 0x4901aa71 },
+            { 0x8c1af8f0, 0x08b1b754, 0x246299b4, 0xce0f7a7c, 0x1e06d939, 0xf760b0f9, 0x726d1213, 0x41bb887b },
+        },
+    },
+    {
+        {
+            { 0x7c6691ae, 0x7e234c59, 0x0a85b4c8, 0x64889d3d, 0x354afae7, 0xdae2c90c, 0x0c6a9e1d, 0x0a871e07 },
+            { 0x744346be, 0x40e87d44, 0x15b52b25, 0x1d48dad4, 0xa13b603e, 0x7c3a8a18, 0x2fcdbdf7, 0x4eb728c1 },
+            { 0x4bbc8989, 0x3301b599, 0x5bdd4260, 0x736bae3a, 0x19d59e3c, 0x0d61ade2, 0x2685d464, 0x3ee7300f },
+        },
+        {
+            { 0x841e7518, 0x43fa7947, 0x639c46d7, 0xe5c6fa59, 0xe3052b74, 0xa1065e1d, 0xcfb89030, 0x7d47c6a2 },
+            { 0x9e7dd6b7, 0xf5d255e4, 0x610b1eac, 0x8016115c, 0x92e187ca, 0x3c99975d, 0x979125c2, 0x13815762 },
+            { 0x8ef0d6e0, 0x3fdad014, 0x91546f3c, 0x9d3e749a, 0x26bb8157, 0x71ec6210, 0x34c9ec80, 0x148cf58d },
+        },
+        {
+            { 0x9ae4756d, 0xe2572f7d, 0x88f3487f, 0x56c345bb, 0x6960a88d, 0x9fd10b6d, 0x4eaea1b9, 0x278febad },
+            { 0x7934f027, 0x46a492f6, 0xf6840aa9, 0x469984be, 0x89611854, 0x5ca1bc2a, 0xbd5dbbd4, 0x3ff2fa1e },
+            { 0x8c933966, 0xb1aa681f, 0x20290c98, 0x8c21949c, 0x219d3c52, 0x39115291, 0xfe9c677b, 0x4104dd02 },
+        },
+        {
+            { 0xdb096ab8, 0x81214e06, 0x0ce44f35, 0x21a8b6c9, 0x409e2af5, 0x6524c12a, 0x8efca481, 0x0165b5a4 },
+            { 0x1124422a, 0x72b2bf5e, 0x98a33ab5, 0xa1fa0c33, 0xfa52b666, 0x94cb6101, 0xafaf53d5, 0x2c863b00 },
+            { 0xa0846a76, 0xf190a474, 0xcd2f7cc0, 0x12eff984, 0x58aa2b8f, 0x695e2906, 0xbffec8b8, 0x591b67d9 },
+        },
+        {
+            { 0x9f18b55d, 0x99b9b371, 0xa18c641e, 0xe465e5fa, 0xc29f05ed, 0x61081136, 0x7030128b, 0x489b4f86 },
+            { 0x80b49bfa, 0x312f0d1c, 0xabf3ec8a, 0x5979515e, 0x9ef01c88, 0x727033c0, 0xca8f7bcb, 0x3de02ec7 },
+            { 0x3aeb92ef, 0xd232102d, 0x6116a861, 0xe16253b4, 0x190baa24, 0x3d7eabe7, 0x496cbebf, 0x49f5fbba },
+        },
+        {
+            { 0x1e9c572e, 0x155d628c, 0xc5884741, 0x8a4d86ac, 0x515763eb, 0x91a352f6, 0x8867515b, 0x06a1a6c2 },
+            { 0x8a5bcfd4, 0x30949a10, 0xbc6473eb, 0xdc40dd70, 0x307c0d1c, 0x92c294c1, 0xcbfa6e74, 0x5604a86d },
+            { 0x7c1764b6, 0x7288d1d4, 0xe0418b51, 0x72541140, 0x18acf6d1, 0x9f031a60, 0xfe2742c6, 0x20989e89 },
+        },
+        {
+            { 0x85eaec2e, 0x1674278b, 0x7acb2bdf, 0x5621dc07, 0x61cbf45a, 0x640a4c16, 0xf70595d3, 0x730b9950 },
+            { 0x3a2dcc7f, 0x499777fd, 0xa54fd892, 0x32857c2c, 0xd207e3a0, 0xa279d864, 0x0ca67e29, 0x0403ed1d },
+            { 0x874ec552, 0xc94b2d35, 0x98246f8d, 0xc5e6c8cf, 0x16c035ce, 0xf7cb46fa, 0x08303dcc, 0x5bd74543 },
+        },
+        {
+            { 0x15e7792a, 0x85c49321, 0xbdcdddc9, 0xc64c89a2, 0xada3d762, 0x9d1e3da8, 0x3067f82c, 0x5bb7db12 },
+            { 0x28b24cc2, 0x7f9ad195, 0x6335c181, 0x7f6b5465, 0x4fc07236, 0x66b8b66e, 0x7380ad83, 0x133a7800 },
+            { 0xc6ca62be, 0x0961f467, 0x211952ee, 0x04ec21d6, 0x9bd54770, 0x18236077, 0x58f0e0d2, 0x740dca6d },
+        },
+    },
+    {
+        {
+            { 0x0478433c, 0x231a8c57, 0xc281439d, 0xb7b5270e, 0xe3d9079f, 0xdbaa99ea, 0x6c2b03d9, 0x2c03f525 },
+            { 0x52cfce4e, 0xdf48ee07, 0x06ec08b7, 0xc3fffaf3, 0xb95459c4, 0x05710b2a, 0x963ea38d, 0x161d25fa },
+            { 0x7b53a47d, 0x790f1875, 0xcf0c5879, 0x307b0130, 0x257ef7f9, 0x31903d77, 0xbd96bbaf, 0x699468bd },
+        },
+        {
+            { 0x6aa91948, 0xd8dd3de6, 0x2fc0d2cc, 0x485064c2, 0x34fdea2f, 0x9b482466, 0x6c4a2e3a, 0x293e1c4e },
+            { 0xf4dafecf, 0xbd1f2f46, 0xa47fd6f7, 0x7cef0114, 0x4a47b37f, 0xd31ffdda, 0x73905785, 0x525219a4 },
+            { 0x925112e1, 0x376e134b, 0xdca15da0, 0x703778b5, 0x461c3111, 0xb04589af, 0x7f032823, 0x5b605c44 },
+        },
+        {
+            { 0xf0e7f04c, 0x3be9fec6, 0x75e34962, 0x866a579e, 0x1e1de61a, 0x5542ef16, 0xcc5abdd5, 0x2f12fef4 },
+            { 0x20c47c89, 0xb9658059, 0x923b8fcc, 0xe7f0100c, 0x02e2ef77, 0x00012565, 0xa8aeb3ee, 0x24a76dce },
+            { 0xdfc0c740, 0x0a4522b2, 0x40c9a407, 0x10d06e7f, 0x78cff668, 0xc6cf1441, 0x18a43790, 0x5e607b25 },
+        },
+        {
+            { 0xa596cf14, 0xa02c431c, 0xaed3e400, 0xe3c42d40, 0x2e0f26db, 0xd2452680, 0x9e457068, 0x201f3313 },
+            { 0x6cdf1818, 0x58b31d8f, 0xc36258a2, 0x35cfa74f, 0x66e61d6e, 0xe1b3ff4f, 0x6ccdd5f7, 0x5067acab },
+            { 0x08039d51, 0xfd527f6b, 0x017c0006, 0x18b14964, 0x2e25a4a8, 0xd5220eb0, 0x62460375, 0x397cba88 },
+        },
+        {
+            { 0xc81379e7, 0x7815c3fb, 0xdde12af1, 0xa6619420, 0x85a8fdd5, 0xffa9c0f8, 0xc1e1c252, 0x771b4022 },
+            { 0xf05959b2, 0x30c13093, 0xe9a97976, 0xe23aa18d, 0x721d5e26, 0x222fd491, 0x766e6c3a, 0x2339d320 },
+            { 0x513a2fa7, 0xd87dd986, 0xf9d4cf08, 0xf5ac9b71, 0x1ea283b3, 0xd06bc31b, 0x19971a76, 0x331a1892 },
+        },
+        {
+            { 0x9d7572af, 0x26512f3a, 0x68074a9e, 0x5bcbe288, 0x1180f7c4, 0x84edc1c1, 0xf649a67b, 0x1ac9619f },
+            { 0xfb4f80c6, 0xf5166f45, 0x61c775cf, 0x9c36c7de, 0x9041d91c, 0xe3d4e81b, 0x83bdfe21, 0x31167c6b },
+            { 0x524b1068, 0xf22b3842, 0xee9ce987, 0x5068343b, 0x4a6250c8, 0xfc9d7184, 0x1f08b111, 0x61243634 },
+        },
+        {
+            { 0x1a2d2638, 0x8b6349e3, 0x9bd3fd35, 0x9ddfb700, 0xa3a06ba4, 0x7f8bf1b8, 0x78d90445, 0x1522aa31 },
+            { 0x874e898d, 0xd99d41db, 0x6c07dc20, 0x09fea5f1, 0xd00f9bbc, 0x793d2c67, 0x9e5eff40, 0x46ebe230 },
+            { 0x69614938, 0x2c382f53, 0xb72d6d10, 0xdafe409a, 0xb646f227, 0xe8c83391, 0x0524306c, 0x45fe70f5 },
+        },
+        {
+            { 0xc8951491, 0x62f24920, 0x3f630ca2, 0x05f007c8, 0xf5c9d4b8, 0x6fbb45d2, 0xb57a2245, 0x16619f6d },
+            { 0x960c0b8c, 0xda4875a6, 0xef0e2f20, 0x5b68d076, 0x3d0b8fd4, 0x07fb51cf, 0xa0e392d4, 0x428d1623 },
+            { 0x01a308fd, 0x084f4a44, 0x76a5caac, 0xa82219c3, 0x43d1bc7d, 0xdeb8de46, 0x60bd38c6, 0x1d81592d },
+        },
+    },
+    {
+        {
+            { 0x7b85c5e8, 0x8765b69f, 0xd168bab2, 0x6ff0678b, 0x1d330f9b, 0x3a70e77c, 0xb0af8e7c, 0x3a5f6d51 },
+            { 0xa60dac5f, 0x61368756, 0xebabdc57, 0x17e02f6a, 0x4cce0f7d, 0x7f193f2d, 0x89ecdcf0, 0x20234a77 },
+            { 0x7178b252, 0x76d20db6, 0xd51ed160, 0x071c34f9, 0xb3e41170, 0xf62a4a20, 0x3cffe366, 0x7cd68235 },
+        },
+        {
+            { 0x68acf4f3, 0xa665cd60, 0x3cd7e3d3, 0x42d92d18, 0x336025d9, 0x5759389d, 0x2b2cd8ff, 0x3ef0253b },
+            { 0xd887fab6, 0x0be1a45b, 0xba403b6e, 0x2a846a32, 0xe96e6000, 0xd9921012, 0x3bdc0943, 0x2838c886 },
+            { 0x4a465030, 0xd16bb0cf, 0x15c577ab, 0xfa496b41, 0xf4ab419d, 0x82cfae8a, 0x06a82812, 0x21dcb8a6 },
+        },
+        {
+            { 0xbe7731ba, 0x9a8d00fa, 0x629e1889, 0x8203607e, 0x43f3d97f, 0xb2cc0237, 0x6c6f678b, 0x5d840dbf },
+            { 0x8c9d9fc8, 0x5c600446, 0xd42aa3cb, 0x2540096e, 0x12ee2f9c, 0x125b4d4c, 0x94a31dab, 0x0bc3d081 },
+            { 0x309fe18b, 0x706e380d, 0xb9e165c7, 0x6eb02da6, 0x7dae20ab, 0x57bbba99, 0x2ac196dd, 0x3a427623 },
+        },
+        {
+            { 0xdb447ecb, 0x3bf8c172, 0xc6282dbd, 0x5fcfc41f, 0x75aa15fe, 0x80acffc0, 0x24e1a9f9, 0x0770c9e8 },
+            { 0x8a7084fa, 0x4b42432c, 0xdfb9e545, 0x898a19e3, 0x9c58e45d, 0xbe9f0021, 0xa16debd1, 0x1ff177ce },
+            { 0x45b5b5fd, 0xcf61d99a, 0x1b3a7924, 0x860984e9, 0x303e3e89, 0xe7300919, 0x41500b1e, 0x39f264fd },
+        },
+        {
+            { 0xfe097be1, 0xd19b4aab, 0xdfe01929, 0xa46dfce1, 0x2ca6f1ff, 0xc3c90894, 0x2c35f14e, 0x65c62127 },
+            { 0xdbe7e29c, 0xa7ad3417, 0x2b9c139c, 0xbd94376a, 0x93597ba9, 0xa0e91b8e, 0x68889840, 0x1712d734 },
+            { 0xce3193dd, 0xe72b89f8, 0xa125c0bb, 0x4d103356, 0x2e1cfe83, 0x0419a93d, 0xb19ce272, 0x22f9800a },
+        },
+        {
+            { 0x9a6efdac, 0x42029fdd, 0x34a54941, 0xb912cebe, 0x87bdf37b, 0x640f64b9, 0x8598cab4, 0x4171a4d3 },
+            { 0x3e9ef8cb, 0x605a368a, 0xa5504715, 0xe3e9c022, 0x5f24248f, 0x553d48b0, 0x647626e5, 0x13f416cd },
+            { 0x99c94c8c, 0xfa2758aa, 0xb000b807, 0x23006f6f, 0xadda5392, 0xfbd291dd, 0x574bd1ab, 0x508214fa },
+        },
+        {
+            { 0x53d003d6, 0x461a15bb, 0xbcf3c965, 0xb2102888, 0x6c683a5a, 0x27c57675, 0xc86cb447, 0x3a7758a4 },
+            { 0x3ed6fe4b, 0xc2026915, 0x511d77c4, 0xa65a6739, 0x2c14af94, 0xcbde2646, 0x6faba74b, 0x22f960ec },
+            { 0x93ae5076, 0x548111f6, 0x1dfd54a6, 0x1dae21df, 0xf3115e65, 0x12248c90, 0x8de7f494, 0x5d9fd15f },
+        },
+        {
+            { 0xeed7521e, 0x3f244d2a, 0x432e9615, 0x8e3a9028, 0x2e9c16d4, 0xe164ba77, 0x47eb98d8, 0x3bc187fa },
+            { 0x6d63727f, 0x031408d3, 0xd7c7b533, 0x6a379aef, 0xccaee24b, 0xa9e18fc5, 0x4f8fbed3, 0x332f3591 },
+            { 0xea86c20c, 0x6d470115, 0x6c46d125, 0x998ab7cb, 0x3a660188, 0xd77832b5, 0x906fba03, 0x450d81ce },
+        },
+    },
+    {
+        {
+            { 0x1cae743f, 0xd074d896, 0xee1c63ed, 0xf86d18f5, 0xe7f4ed29, 0x97bdc55b, 0x663ab108, 0x4cbad279 },
+            { 0xa6205275, 0x6e7bb6a1, 0x413c8e83, 0xaa4f21d7, 0xe88f5cb2, 0x6f56d155, 0xa6345be1, 0x2de25d4b },
+            { 0xa0d71fcd, 0x80d19024, 0xfb288af8, 0xc525c20a, 0x5f3a6419, 0xb1a3974b, 0xe2007233, 0x7d7fbcef },
+        },
+        {
+            { 0xf3c29094, 0xcd7c5dc5, 0x2a9105ab, 0xc781a29a, 0x421c3058, 0x80c61d36, 0xdcd8d4d7, 0x4f9cd196 },
+            { 0x266b2801, 0xfaef1e6a, 0xd5739f16, 0x866c68c4, 0x1b03762c, 0xf68a2fbc, 0x87b75a8d, 0x5975435e },
+            { 0x6a7b3768, 0x199297d8, 0x1ad17a63, 0xd0d05824, 0x5c1c0c17, 0xba029cad, 0x387a0307, 0x7ccdd084 },
+        },
+        {
+            { 0x6760cc93, 0x9b0c8418, 0x1ab32a99, 0xcdae007a, 0x620bda18, 0xa88dec86, 0x8190ca44, 0x3593ca84 },
+            { 0x6d260417, 0xdca6422c, 0x948240bd, 0xae153d50, 0xfb68c677, 0xa9c0c1b4, 0x61d0cf53, 0x428bd0ed },
+            { 0x5e849aa7, 0x9213189a, 0x65d8facd, 0xd4d8c335, 0x53fdbbd1, 0x8c52545b, 0xda2d63e6, 0x27398308 },
+        },
+        {
+            { 0x0a702453, 0xb9a10e4c, 0xd57d1bde, 0x0fa25866, 0xcd27daf7, 0xffb9d9b5, 0x492c33fd, 0x572c2945 },
+            { 0x435ed413, 0x42c38d28, 0x3278ccc9, 0xbd50f360, 0x79da03ef, 0xbb07ab1a, 0xbe8c3355, 0x269597ae },
+            { 0xd6cd30be, 0xc77fc745, 0xe3baaefb, 0xe4dfe8d3, 0xaa5dda0c, 0xa22c8830, 0xc05bca80, 0x7f985498 },
+        },
+        {
+            { 0x0fbf6363, 0xd3561552, 0xcf4dfba6, 0x08045a45, 0x873fa0c2, 0xeec24fbc, 0xd69b12e7, 0x30f2653c },
+            { 0x9f0be117, 0x3849ce88, 0x7b54a288, 0x8005ad1b, 0x23fc921c, 0x3da3c39f, 0x0a31f304, 0x76c2ec47 },
+            { 0xaac10c85, 0x8a08c938, 0xdb276bcb, 0x46179b60, 0x0e6fac70, 0xa920c01e, 0x596473da, 0x2f1273f1 },
+        },
+        {
+            { 0x55a70bc0, 0x30488bd7, 0xf1d442e7, 0x06d6b5a4, 0xbc596162, 0xead1a69e, 0xedc5f784, 0x38ac1997 },
+            { 0x8ae01e11, 0x4739fc7c, 0x4a6aab9f, 0xfd527490, 0x87728f2e, 0x41d98a82, 0xd85b69f2, 0x5d9e572a },
+            { 0xa751b13b, 0x0666b517, 0x7e9b858c, 0x747d0686, 0x454dde49, 0xacacc011, 0xbfe9e69c, 0x22dfcd9c },
+        },
+        {
+            { 0x103be0a1, 0x56ec59b4, 0xd259f969, 0x2ee3baec, 0x13f5cd32, 0x797cb294, 0x24cde472, 0x0fe98778 },
+            { 0xc30d0cd9, 0x8ddbd2e0, 0xacbb4333, 0xad8e665f, 0x322a961f, 0x8f6b258c, 0x5448c1c7, 0x6b2916c0 },
+            { 0x0aba913b, 0x7edb34d1, 0x2e6dac0e, 0x4ea3cd82, 0x6578f815, 0x66083dff, 0x7ff00a17, 0x4c303f30 },
+        },
+        {
+            { 0x0dd94500, 0x29fc0358, 0x6fbbec93, 0xecd27aa4, 0xc2e2a7f8, 0x130a155f, 0xb706a1d5, 0x416b151a },
+            { 0x17b28c85, 0xd30a3bd6, 0x39773bea, 0xc5d377b7, 0x1e6a5cbf, 0xc6c6e78c, 0x8b2ab7c4, 0x0d61b8f7 },
+            { 0xe9c136b0, 0x56a8d7ef, 0x58e44b20, 0xbd07e5cd, 0x1b57e0ab, 0xafe62fda, 0x4277e8d2, 0x191a2af7 },
+        },
+    },
+    {
+        {
+            { 0x4f460efb, 0x9fe62b43, 0xa63607d6, 0xded303d4, 0xb7a0da24, 0xf052210e, 0x00545b93, 0x237e7dbe },
+            { 0xc53c1431, 0xce16f74b, 0x2072edde, 0x2b9725ce, 0xb5b23ee7, 0xb8b9c36f, 0x0b5cc908, 0x7e2e0e45 },
+            { 0x6701b430, 0x013575ed, 0x9f0bfd10, 0x231094e6, 0x83e47f22, 0x75320f15, 0xb11155e3, 0x71afa699 },
+        },
+        {
+            { 0x473b50d6, 0xea423c1c, 0x3b38ef10, 0x51e87a1f, 0xb2c9be95, 0x9b84bf5f, 0x78f89a1c, 0x00731fbc },
+            { 0x3953b61d, 0x65ce6f9b, 0xafa141e6, 0xc65839ea, 0xa9f759fe, 0x0f435ffd, 0xc2b1c28e, 0x021142e9 },
+            { 0x48f81880, 0xe430c718, 0x5ecec119, 0xbf960c22, 0x6bba15e3, 0xb6dae083, 0x47e15808, 0x4c4d6f33 },
+        },
+        {
+            { 0x988f1970, 0x2f0cddfc, 0xb0b9f51b, 0x6b916227, 0x779176be, 0x6ec7b6c4, 0xa88f9fa8, 0x38bf9500 },
+            { 0xc17d1fc9, 0x18f7eccf, 0x51403c14, 0x6c75f5a6, 0xf7ee0cdf, 0xdbde712b, 0xa7e47a22, 0x193fddaa },
+            { 0x37e8876f, 0x1fd2c93c, 0x18d1462c, 0xa2f61e5a, 0x39241276, 0x5080f582, 0xbf0d4969, 0x6a6fb99e },
+        },
+        {
+            { 0xb6e423c6, 0xeeb122b5, 0xf286ff8e, 0x939d7010, 0x1dcf5d8c, 0x90a92a83, 0x42c5eb10, 0x136fda9f },
+            { 0x560855eb, 0x6a46c1bb, 0xf893f09d, 0x2416bb38, 0x8f71acc1, 0xd71d1137, 0xa31896ea, 0x75f76914 },
+            { 0xa305bdd1, 0xf94cdfb1, 0x9ff82c08, 0x0f364b9d, 0xc3bb588a, 0x2a87d8a5, 0x0be8dcba, 0x02218351 },
+        },
+        {
+            { 0x43307a7f, 0x9d5a7101, 0xc47da45f, 0xb063de9e, 0xbe927ad3, 0x22bbfe52, 0xfd40426c, 0x1387c441 },
+            { 0x5ead2d14, 0x4af76638, 0xca7c5830, 0xa08ed880, 0x10211e3d, 0x0d13a6e6, 0x7b806c03, 0x6a071ce1 },
+            { 0x87978af8, 0xb5d3c3d1, 0x7f0e4413, 0x722b5a3d, 0xbb477ca0, 0x0d7b4848, 0xaf1edc92, 0x3171b26a },
+        },
+        {
+            { 0xb28a47d1, 0xa60db7d8, 0x1770a4f1, 0xa6bf14d6, 0x53ddbd58, 0xd4a1f893, 0x344243e9, 0x6c514a63 },
+            { 0x97564ca8, 0xa92f3190, 0x2275e119, 0xff7bb84c, 0xa4875150, 0x4f55fe37, 0x3cf0835a, 0x221fd487 },
+            { 0x3a156341, 0x2322204f, 0xba0a032d, 0xfb73e0e9, 0x410f030e, 0xfce0dd4c, 0xfb924aaa, 0x48daa596 },
+        },
+        {
+            { 0xc84c9793, 0x14f61d5d, 0xef418206, 0x9941f9e3, 0x346277ac, 0xcdf5b88f, 0x0e8a79a9, 0x58c837fa },
+            { 0x5ca59cc7, 0x6eca8e66, 0x2e38aca0, 0xa847254b, 0xd21e17ce, 0x31afc708, 0xcad84af7, 0x676dd6fc },
+            { 0x96fc9058, 0x0cf96885, 0x7b56a01b, 0x1ddcbbf3, 0x4935d66a, 0xdcc2e77d, 0xc6a57f0a, 0x1c4f73f2 },
+        },
+        {
+            { 0xfc7c3484, 0xb36e706e, 0xc3c1cf61, 0x73dfc9b4, 0x781cc7e5, 0xeb1d79c9, 0x7daf675c, 0x70459adb },
+            { 0x305fa0bb, 0x0e7a4fbd, 0x54c663ad, 0x829d4ce0, 0x2fe33848, 0xf421c383, 0x1bf64c42, 0x795ac80d },
+            { 0x91b42bb3, 0x1b91db49, 0x4b02dcca, 0x57269623, 0x1f8c78dc, 0x9fdf9ee5, 0x8ce21fd3, 0x5fe16284 },
+        },
+    },
+    {
+        {
+            { 0x5d7cb208, 0x2879852d, 0x687df2e7, 0xb8dedd70, 0x21687891, 0xdc0bffab, 0x677daa35, 0x2b44c043 },
+            { 0xe194961a, 0x4e59214f, 0x0d71cd4f, 0x49be7dc7, 0x3b50f22d, 0x9300cfd2, 0xfc917232, 0x4789d446 },
+            { 0x074eb78e, 0x1a1c87ab, 0x99daf467, 0xfac6d18e, 0x484f9067, 0x3eacbbcd, 0x2bb9a4e4, 0x60c52eef },
+        },
+        {
+            { 0x7cae6d11, 0x702bc5c2, 0x54a48cab, 0x44c7699b, 0xba492eb2, 0xefbc4056, 0xd9b6676d, 0x70d77248 },
+            { 0x3bfd8bf1, 0x0b5d89bc, 0xc9f3551a, 0xb06b9237, 0xd53028f5, 0x0e4c16b0, 0x2ccfcaab, 0x10bc9c31 },
+            { 0x3ec2a05b, 0xaa8ae84b, 0xed1781e0, 0x98699ef4, 0x708e85d1, 0x794513e4, 0xa976f413, 0x63755bd3 },
+        },
+        {
+            { 0x97f1acb7, 0x3dc71018, 0xc165bbd8, 0x5dda7d5e, 0x0fa1020f, 0x508e5b9c, 0x37c52a56, 0x27637517 },
+            { 0x2ad10853, 0xb55fa03e, 0x9ee63569, 0x356f7590, 0xbe69b890, 0x9ff9f1fd, 0x8bc16f84, 0x0d8cc1c4 },
+            { 0x6eb419a9, 0x029402d3, 0x77b460a5, 0xf0b44e7e, 0xd43c4956, 0xcfa86230, 0x7ad166e7, 0x70c2dd8a },
+        },
+        {
+            { 0xb8ed7e13, 0x91d4967d, 0xd776817a, 0x74252f0a, 0x0d852564, 0xe40982e0, 0x16a53ce5, 0x32b86138 },
+            { 0x9f6fec0e, 0x65619450, 0x46c6518d, 0xee2e7ea9, 0x67e09b5c, 0x9733c1f3, 0x63948495, 0x2e0fac63 },
+            { 0xe448cd64, 0x79e7f7be, 0x087886d0, 0x6ac83a67, 0xa0e4db2e, 0xf89fd4d9, 0x735a4f41, 0x4179215c },
+        },
+        {
+            { 0x286bcd34, 0xe4ae33b9, 0x559dd6dc, 0xb7ef7eb6, 0xb3d38e1f, 0x278b141f, 0x2241c286, 0x31fa8566 },
+            { 0xd7dced2a, 0x8c7094e7, 0x47d39c70, 0x97fb8ac3, 0xa906d902, 0xe13be033, 0x0cd99d76, 0x700344a3 },
+            { 0x2e3622f4, 0xaf826c42, 0x9833502d, 0xc1202987, 0x2b389123, 0x9bc1b7e1, 0xa9952489, 0x24bb2312 },
+        },
+        {
+            { 0xf5f85c6b, 0x41f80c2a, 0x04fa6794, 0x687284c3, 0xa3ba1bad, 0x8945df99, 0xffeb5d16, 0x0d1d2af9 },
+            { 0x32de67c3, 0xb1a8ed17, 0x461b4948, 0x3cb49418, 0x76cfbcd2, 0x8ebd4343, 0x1e188008, 0x0fee3e87 },
+            { 0x32621edf, 0xa9da8aa1, 0x59226579, 0x30b822a1, 0xa79ac193, 0x4004197b, 0x18531d76, 0x16acd797 },
+        },
+        {
+            { 0x7887b6ad, 0xc959c6c5, 0x5f90feba, 0x94e19ead, 0xa342f504, 0x16e24e62, 0x18161700, 0x164ed34b },
+            { 0x2d9b1d3d, 0x72df72af, 0xa432245a, 0x63462a36, 0x16b39637, 0x3ecea079, 0xb9302309, 0x123e0ef6 },
+            { 0x192fe69a, 0x487ed94c, 0x3a911513, 0x61ae2cea, 0xb9a4de27, 0x877bf6d3, 0x1073f3eb, 0x78da0fc6 },
+        },
+        {
+            { 0x680c3a94, 0xa29f80f1, 0x1ae9e7e6, 0x71f77e15, 0x48017973, 0x1100f158, 0x16b38ddd, 0x054aa4b3 },
+            { 0xe52bc66a, 0x5bf15d28, 0x70f01a8e, 0x2c47e318, 0x06c28bdd, 0x2419afbc, 0x256b173a, 0x2d25deeb },
+            { 0x19267cb8, 0xdfc8468d, 0x66e54daf, 0x0b28789c, 0x666eec17, 0x2aeb1d2a, 0xab7da760, 0x134610a6 },
+        },
+    },
+    {
+        {
+            { 0x77d1f515, 0xcd2a65e7, 0x8faa60f1, 0x54899187, 0xdabc06e5, 0xb1b73bbc, 0xa97cc9fb, 0x654878cb },
+            { 0x8df6b0fe, 0x51138ec7, 0xe575f51b, 0x5397da89, 0x717af1b9, 0x09207a1d, 0x2b20d650, 0x2102fdba },
+            { 0x055ce6a1, 0x969ee405, 0x1251ad29, 0x36bca768, 0xaa7da415, 0x3a1af517, 0x29ecb2ba, 0x0ad725db },
+        },
+        {
+            { 0x9b056f85, 0xfec7bc0c, 0xe7f5ffd7, 0x537d5268, 0x4312aefa, 0x77afc662, 0x02399fd9, 0x4f675f53 },
+            { 0x834e2457, 0xdc4267b1, 0x70ce1bc5, 0xb67544b5, 0xf7d15ed7, 0x1af07a0b, 0x71a03650, 0x4aefcffb },
+            { 0x0415171e, 0xc32d3636, 0x8998483b, 0xcd2bef11, 0xd0945110, 0x870a6ead, 0xa2a86561, 0x0bccbb72 },
+        },
+        {
+            { 0x50fe1296, 0x186d5e4c, 0xfee89f7e, 0xe0397b82, 0x507031b0, 0x3bc7f6c5, 0x108f37c2, 0x6678fd69 },
+            { 0xeab1a9c8, 0x185e962f, 0x65147dcd, 0x86e7e635, 0xbb5b6df2, 0xb092e031, 0x59d6b73e, 0x4024f0ab },
+            { 0x636863c2, 0x1586fa31, 0x572d33f2, 0x07f68c48, 0x789eaefc, 0x4f73cc9f, 0x8ead4701, 0x2d42e210 },
+        },
+        {
+            { 0x0f537593, 0x21717b0d, 0x131e064c, 0x914e690b, 0x752ae09f, 0x1bb687ae, 0x9b423c6e, 0x420bf3a7 },
+            { 0x94dfd29b, 0x97f51315, 0x313f4c6a, 0x6155985d, 0x08455010, 0xeba13f07, 0xb8d2d322, 0x676b2608 },
+            { 0x1c5b2b47, 0x8138ba65, 0x311b1b80, 0x8671b6ec, 0xbc3135b0, 0x7bff0cb1, 0x9c0cf1e0, 0x745d2ffa },
+        },
+        {
+            { 0x21d34e6a, 0x6036df57, 0x997bb3d0, 0xb1db8827, 0xc8756afa, 0xd3c209c3, 0x4c1dc839, 0x06e15be5 },
+            { 0x2bc9c8bd, 0xbf525a1e, 0x26479d81, 0xea5b2608, 0xdf0155db, 0xd511c70e, 0x960cf5d0, 0x1ae23ceb },
+            { 0x1932994a, 0x5b725d87, 0xceb1dab0, 0x32351cb5, 0xdab7ca05, 0x7dc41549, 0x278ec1f7, 0x58ded861 },
+        },
+        {
+            { 0xb6c2c9a8, 0x2dfb5ba8, 0xf52c598c, 0x48eeef8e, 0xf12d1573, 0x33809107, 0x531d5bd8, 0x08ba696b },
+            { 0xf266c55c, 0xd8173793, 0xcc454e49, 0xc8c976c5, 0xbc26c3a8, 0x5ce382f8, 0x5485f6f9, 0x2ff39de8 },
+            { 0xc3efc57a, 0x77ed3eee, 0xd4ff4811, 0x04e05517, 0xf1a671cb, 0xea3d7a3f, 0x947cfe54, 0x120633b4 },
+        },
+        {
+            { 0x4912100a, 0x82bd3147, 0x7e6fbe06, 0xde237b6d, 0x11ea79c6, 0xe11e7619, 0xcb393bde, 0x07433be3 },
+            { 0x91610042, 0x0b949878, 0xecebfae8, 0x4ee7b13c, 0x94f0a4c0, 0x70be7395, 0xb4d59185, 0x35d30a99 },
+            { 0x5ce997f4, 0xff7944c0, 0xb05c51a3, 0x575d3de4, 0x5a76847c, 0x583381fd, 0x7af6da9f, 0x2d873ede },
+        },
+        {
+            { 0x4e5df981, 0xaa6202e1, 0x5015e1f5, 0xa20d5917, 0xbae21d6c, 0x18a275d3, 0x01600253, 0x0543618a },
+            { 0x43373409, 0x157a3164, 0xf4aa81d9, 0xfab8b7ee, 0xf5a64806, 0xb093fee6, 0x707fa7b6, 0x2e773654 },
+            { 0x974c23c1, 0x0deabdf4, 0x9dce4693, 0xaa6f0a25, 0xa29aba2c, 0x04202cb8, 0x2d07960d, 0x4b144336 },
+        },
+    },
+    {
+        {
+            { 0x1c529ccb, 0x967c54e9, 0x64c635fb, 0x30f62692, 0x78121965, 0x2747aff4, 0xeaf66f5c, 0x17038418 },
+            { 0xb66e1f7a, 0xccc4b7c7, 0xf50c2f7e, 0x44157e25, 0x713eaf1c, 0x3ef06dfc, 0x52da63f7, 0x582f4467 },
+            { 0x20324ce4, 0xc6317bd3, 0xa4488bc4, 0xa81042e8, 0x4e5a1364, 0xb21ef18b, 0xcda28dc9, 0x0c2a1c4b },
+        },
+        {
+            { 0x69bd6945, 0xedc48148, 0xbe1c8d22, 0x0d6d907d, 0xd55cc5ab, 0xc63bd212, 0xa314dc83, 0x5a6a9b30 },
+            { 0x6f1f0447, 0xd24dc7d0, 0xdb87c059, 0xb2269e3e, 0xfbb2d28f, 0xd15b0272, 0xc6f64877, 0x7c558bd1 },
+            { 0xd396463d, 0xd0ec1524, 0xc35a24f0, 0x12bb628a, 0x1cbc5fa4, 0xa50c3a79, 0x0afbafc3, 0x0404a5ca },
+        },
+        {
+            { 0x2a416fd1, 0x62bc9e1b, 0xe350598b, 0xb5c6f728, 0x3d5d6967, 0x04343fd8, 0xe7f8ee98, 0x39527516 },
+            { 0x0aa743d6, 0x8c1f4007, 0x5b265ee8, 0xccbad0cb, 0x668fd2de, 0x574b046b, 0xcadd9633, 0x46395bfd },
+            { 0x1a5d9a9c, 0x117fdb2d, 0xd1005c2a, 0x9c7745bc, 0x54d56fea, 0xefd4bef1, 0xe822d016, 0x76579a29 },
+        },
+        {
+            { 0x52b434f2, 0x333cb513, 0x93de80e1, 0xd8322849, 0x750d35ce, 0xb5512887, 0x2a2777c1, 0x02c514bb },
+            { 0x49c02a17, 0x45b68e7e, 0xbca9a37f, 0x23cd51a2, 0xec224c1b, 0x3ed65f11, 0x9e05bdb1, 0x43a384dc },
+            { 0x8bf1b645, 0x684bd5da, 0xf6b54b53, 0xfb8bd37e, 0xa9b0d253, 0x313916d7, 0x61548059, 0x11609209 },
+        },
+        {
+            { 0x369b4dcd, 0x7a385616, 0x655c3563, 0x75c02ca7, 0xd4f18021, 0x7dc21bf9, 0x91e6e042, 0x2f637d74 },
+            { 0x29dacfaa, 0xb44d1669, 0x8413598f, 0xda529f4c, 0x453d5559, 0xe9ef63ca, 0xc5698e0b, 0x351e125b },
+            { 0x1af67bbe, 0xd4b49b46, 0xc8ab8961, 0xd603037a, 0xf9a699fb, 0x71dee19f, 0xe7ce2a9a, 0x7f182d06 },
+        },
+        {
+            { 0x8e217522, 0x09454b72, 0xd484b8d8, 0xaa58e8f4, 0x7f46903c, 0xd358254d, 0x241c5217, 0x44acc043 },
+            { 0xab0168ec, 0x7a7c8e64, 0x15edc543, 0xcb5a4a55, 0x47cd0eda, 0x095519d3, 0x343e93b0, 0x67d4ac8c },
+            { 0x4f7a5777, 0x1c7d6bbb, 0x918313e1, 0x8b35fed4, 0xc96b4684, 0x4adca1c6, 0x12ad71bd, 0x556d1c83 },
+        },
+        {
+            { 0xb11be821, 0x81f06756, 0x10a3f3dd, 0x0faff823, 0x6a99465d, 0xf8b2d055, 0xcc8c7f05, 0x097abe38 },
+            { 0x0c8d3982, 0x17ef40e3, 0x15a3fa34, 0x31f7073e, 0x0773646e, 0x4f21f3cb, 0x1d824eff, 0x746c6c6d },
+            { 0x7ea52da4, 0x0c49c987, 0x9bdc1d43, 0x4c436955, 0xf7ccebd2, 0x022c3809, 0x4bee84bd, 0x577e14a3 },
+        },
+        {
+            { 0xbd4dd72b, 0x94fecebe, 0x060f2211, 0xf46a4fda, 0xc0c8d1ff, 0x124a5977, 0xfb009295, 0x705304b8 },
+            { 0x61a73b0a, 0xf0e268ac, 0x3791a5f5, 0xf2fafa10, 0x6b6d00e9, 0xc1e13e82, 0x6fd78f42, 0x60fa7ee9 },
+            { 0x4d296ec6, 0xb63d1d35, 0x5fad31d8, 0xf3c3053e, 0xb4bd42ec, 0x670b958c, 0xa16353fd, 0x21398e0c },
+        },
+    },
+    {
+        {
+            { 0xb4b75601, 0x2798aaf9, 0x5c8dad72, 0x5eac7213, 0x61b7a023, 0xd2ceaa61, 0xe98f7d4e, 0x1bbfb284 },
+            { 0x382b33f3, 0x89f5058a, 0xad48c0b4, 0x5ae2ba0b, 0xa53db36e, 0x8f93b503, 0x95a232e6, 0x5aa3ed9d },
+            { 0xc7d96561, 0x656777e9, 0x72c78036, 0xcb2b1254, 0xd9506eee, 0x65053299, 0x5e8957cc, 0x4a07e14e },
+        },
+        {
+            { 0xc477a49b, 0x240b58cd, 0x6447f017, 0xfd38dade, 0xa7c86aad, 0x19928d32, 0x84afa081, 0x50af7aed },
+            { 0x980df999, 0x4ee412cb, 0x3c6ec771, 0xa315d76f, 0x925c77fd, 0xbba5edde, 0x1d313402, 0x3f0bac39 },
+            { 0x15f65be5, 0x6e4fde01, 0x216109b2, 0x29982621, 0x0badd6d9, 0x78020581, 0xbaebd006, 0x1921a316 },
+        },
+        {
+            { 0xd9f3c18b, 0xd75aad9a, 0x60b1c19c, 0x566a0eef, 0x255c0ed9, 0x3e9a0bac, 0xa062c7f5, 0x7b049dec },
+            { 0xdfb870fc, 0x89422f7e, 0x4f76b3bd, 0x2c296beb, 0x36c24df7, 0x0738f1d4, 0xe273aeb0, 0x6458df41 },
+            { 0x35444483, 0xdccbe37a, 0x0fedbe93, 0x75887933, 0x12c5dd87, 0x786004c3, 0xc2950e64, 0x6093dccb },
+        },
+        {
+            { 0x6084034b, 0x6bdeeebe, 0x780fb854, 0x3199c2b6, 0xb62d0695, 0x973376ab, 0x8b647d90, 0x6e3180c9 },
+            { 0x85e0706d, 0x1ff39a85, 0xb3e73933, 0x36d0a5d8, 0x718f453b, 0x43b9f2e1, 0x4827a97c, 0x57d1ea08 },
+            { 0xa128b071, 0xee7ab6e7, 0x93a88baa, 0xa4c1596d, 0xb2216130, 0xf7b4de82, 0xdd97bd18, 0x363e999d },
+        },
+        {
+            { 0xe24baec6, 0x2f1848dc, 0xbabcaf60, 0x769b7255, 0x3cefe931, 0x90cb3c6e, 0xc6f9b355, 0x231f979b },
+            { 0x35ee1fc4, 0x96a843c1, 0x08e4c8cf, 0x976eb355, 0xb58cd330, 0xb42f6801, 0x693a052b, 0x48ee9b78 },
+            { 0xcc2af3c6, 0x5c31de4b, 0xfe208d1f, 0xb04bb030, 0xc14fb466, 0xb78d7009, 0x08792413, 0x079bfa9b },
+        },
+        {
+            { 0xa2d54245, 0xf3c9ed80, 0x77f63952, 0x0aa08b78, 0xd1085475, 0xd76dac63, 0x9470636b, 0x1ef4fb15 },
+            { 0xda300df4, 0xe3903a51, 0x3da95ab0, 0x84396423, 0x0b356480, 0xed3cf12d, 0x84817194, 0x038c77f6 },
+            { 0x5b167bec, 0x854e5ee6, 0x96d0cdc2, 0x59590a42, 0x98102199, 0x72b2df34, 0x4a0bff56, 0x575ee92a },
+        },
+        {
+            { 0x0aa4d801, 0x5d46bc45, 0xa533b9d8, 0xc3af1227, 0x2b8906c2, 0x389e3b26, 0x382f581b, 0x200a1e7e },
+            { 0x8a182fcf, 0xd4c08090, 0x99489dbd, 0x30e170c2, 0x52f733de, 0x05babd57, 0x2cd3fd00, 0x43d4e711 },
+            { 0xeaf93ac5, 0x518db967, 0x056652c0, 0x71bc989b, 0x567197f5, 0xfe2b85d9, 0x651e4e38, 0x050eca52 },
+        },
+        {
+            { 0x60e668ea, 0x97ac3976, 0x153ab497, 0x9b19bbfe, 0x34eca79f, 0x4cb179b5, 0xa131ae57, 0x6151c09f },
+            { 0x453f0c9c, 0xc3431ade, 0xff703b9b, 0xe9f5045e, 0xed847b3d, 0xfcd97ac9, 0x1c58f4c6, 0x4b0ee6c2 },
+            { 0xfdf05d96, 0x3af55c0d, 0x2ab4ee7a, 0xdd262ee0, 0x12171709, 0x11b2bb87, 0x800f030b, 0x1fef24fa },
+        },
+    },
+    {
+        {
+            { 0x30976b86, 0x22d2aff5, 0xc2d24604, 0x8d90b806, 0x4de5bae5, 0xdca1896c, 0xc8340c17, 0x28005fe6 },
+            { 0x1aa73196, 0x37d653fb, 0x3fd76418, 0x0f949530, 0xfb3a17b2, 0xad200b09, 0x2fc8613e, 0x544d4929 },
+            { 0x34528688, 0x6aefba9f, 0x25107da1, 0x5c1bff94, 0x66d94b36, 0xf75bbbcd, 0x0f316dfa, 0x72e47293 },
+        },
+        {
+            { 0xd32a7627, 0x07f3f635, 0x5f6566f0, 0x7aaa4d86, 0x28d04450, 0x3c85e797, 0x0fe06438, 0x1fee7f00 },
+            { 0x9781084f, 0x2695208c, 0x23450ee1, 0xb1502a0b, 0x03efde02, 0xfd9daea6, 0x2733a34c, 0x5a9d2e8c },
+            { 0x03dbf7e5, 0x765305da, 0x1434cdbd, 0xa4daf249, 0xd24a88ec, 0x7b4ad5cd, 0xee040543, 0x00f94051 },
+        },
+        {
+            { 0x07af9753, 0xd7ef93bb, 0x3db766a7, 0x583ed0cf, 0x6e0b1ec5, 0xce6998bf, 0x5dd40452, 0x47b7ffd2 },
+            { 0xc3d330b2, 0x8d356b23, 0xb0471b06, 0xf21c8b9b, 0x6e42b83c, 0xb36c316c, 0x8beab10d, 0x07d79c7e },
+            { 0xbc08dd12, 0x87fbfb9c, 0xe1eec29b, 0x8a066b3a, 0xdb1fc1bf, 0x0d57242b, 0x5ea64bb6, 0x1c3520a3 },
+        },
+        {
+            { 0x216bc059, 0xcda86f40, 0x12bcd87e, 0x1fbb231d, 0x17c70990, 0xb4956a9e, 0x66d12e55, 0x38750c3b },
+            { 0xbccba34a, 0x80d253a6, 0x3838219b, 0x3e61c3a1, 0x9882e396, 0x90c3b601, 0x5d0ee66f, 0x1c3d0577 },
+            { 0x9422e51a, 0x692ef140, 0x2b5df671, 0xcbc0c73c, 0x744ce029, 0x21014fe7, 0xd330487c, 0x0621e2c7 },
+        },
+        {
+            { 0xb0dbf0f3, 0xb7ae1796, 0xe17ce196, 0x54dfafb9, 0xe9aaa3b4, 0x25923071, 0xa1002e9d, 0x5d8e589c },
+            { 0x8259838d, 0xaf9860cc, 0xc69f9adc, 0x90ea48c1, 0x65581e30, 0x65264837, 0x7bd3a5bc, 0x0007d609 },
+            { 0x0842a94b, 0xc0bf1d95, 0x588f2e3e, 0xb2d3c363, 0xbb51e2ef, 0x0a961438, 0x3c1cbf86, 0x1583d778 },
+        },
+        {
+            { 0xcc9d28c7, 0x90034704, 0xf72cc58f, 0x1d1b679e, 0xbe5b8726, 0x16e12b5f, 0x83c5580a, 0x4958064e },
+            { 0x5da27ae1, 0xeceea2ef, 0x55670174, 0x597c3a14, 0x6609167a, 0xc9a62a12, 0x81ed8f70, 0x252a5f2e },
+            { 0x5066e80d, 0x0d289426, 0x307c8c6b, 0xfcc3f785, 0x0c1112fd, 0x1b53da78, 0xd843b388, 0x079c170b },
+        },
+        {
+            { 0xc0d5d056, 0xcdd6cd50, 0xbb03573b, 0x9af7686d, 0xf3c3ef48, 0x3ca6723f, 0x317b8acc, 0x6768c0d7 },
+            { 0x64fa6fff, 0x0506ece4, 0x6205e523, 0xbee3431e, 0x51b8ea42, 0x35794224, 0x4ac9fb00, 0x6dec05e3 },
+            { 0xf155c1b3, 0x94b625e5, 0x997b7b91, 0x417bf3a7, 0x6d6b2600, 0xc22cbddc, 0xddcd52f4, 0x51445e14 },
+        },
+        {
+            { 0x2bbea455, 0x893147ab, 0x92079129, 0x8c53a24f, 0xbe30f7a7, 0x4b49f948, 0x6e4fd43d, 0x12e99008 },
+            { 0x3b144951, 0x57502b4b, 0x444bbcb3, 0x8e67ff6b, 0x166385db, 0xb8bd6927, 0xe39295c8, 0x13186f31 },
+            { 0x7fdfbb2e, 0xf10c96b3, 0x121ceaf9, 0x9f9a935e, 0x3a5b983f, 0xdf1136c4, 0x5d3e99af, 0x77b2e3f0 },
+        },
+    },
+    {
+        {
+            { 0x12ddb0a4, 0xd598639c, 0xc024866b, 0xa5d19f30, 0x58fce460, 0xd17c2f03, 0x2e095e8a, 0x07a19515 },
+            { 0x9c2ec4de, 0x296fa9c5, 0x4f84f3cb, 0xbc8b61bf, 0x17a8f908, 0x1c7706d9, 0x7ad3255d, 0x63b795fc },
+            { 0x389e5fc8, 0xa8368f02, 0xcf8de43b, 0x90433b02, 0xc5412643, 0xafa1fd5d, 0x032f0137, 0x3e8fe83d },
+        },
+        {
+            { 0xe8efd13c, 0x08704c8d, 0x33e03731, 0xdfc51a8e, 0x1260cde3, 0xa59d5da5, 0xa6258c86, 0x22d60899 },
+            { 0x0570a294, 0x2f8b15b9, 0x67084549, 0x94f24270, 0x61bbfd84, 0xde1c5ae1, 0x7fac4007, 0x75ba3b79 },
+            { 0x70cdd196, 0x6239dbc0, 0x6c7d8a9a, 0x60fe8a8b, 0xeb401260, 0xb38847bc, 0x87779e5e, 0x0904d07b },
+        },
+        {
+            { 0x48f940b9, 0xf4322d66, 0xbd2d0c39, 0x06952f0c, 0xa081f931, 0x167697ad, 0xbaf72a6c, 0x6240aace },
+            { 0xddba919c, 0xb4ce1fd4, 0xc74c8daa, 0xcf31db3e, 0xad86cc51, 0x2c63cc63, 0xbc1dde07, 0x43e2143f },
+            { 0x5ba295a0, 0xf834749c, 0xca37d25a, 0xd6947c5b, 0xe7c9316a, 0x66f13ba7, 0x8db40cac, 0x56bdaf23 },
+        },
+        {
+            { 0xc19d3bb2, 0x1310d36c, 0x622386b9, 0x062a6bb7, 0xd7a14f5c, 0x7c9b8591, 0x7e1e5754, 0x03aa3150 },
+            { 0xf53533eb, 0x362ab9e3, 0x6eb93d40, 0x338568d5, 0x1d5a5572, 0x9e0e1452, 0x83741318, 0x1d24a86d },
+            { 0xffd4ce1f, 0xf4ec7648, 0x54ac8c1c, 0xe045eaf0, 0x1d09357c, 0x88d22582, 0x9aeb4859, 0x43b261dc },
+        },
+        {
+            { 0x6c951364, 0x19513d8b, 0x000bf47b, 0x94fe7126, 0xd54f9567, 0x028d10dd, 0x42940964, 0x02b4d5e2 },
+            { 0x88bb79bb, 0xe55b1e19, 0xc17a359d, 0xa09ed07d, 0x603dea33, 0xb02c2ee2, 0x5b276bc2, 0x326055cf },
+            { 0x28d18df2, 0xb4a155cb, 0x186ce508, 0xeacc4646, 0x6c824389, 0xc49cf493, 0xae5d3410, 0x27a6c809 },
+        },
+        {
+            { 0xc43d6954, 0xcd2c270a, 0x6a66cab2, 0xdd4a3e57, 0x69d7036c, 0x79fa5924, 0x3d8c2599, 0x22150360 },
+            { 0x1f0db188, 0x8ba6ebcd, 0x675a5be8, 0x37d3d73a, 0x15f5585a, 0xf22edfa3, 0xff60a17e, 0x2cb67174 },
+            { 0x390be1d0, 0x59eecdf9, 0x728ce3f1, 0xa9422044, 0x7a94f0f4, 0x82891c66, 0x3890f436, 0x7b1df4b7 },
+        },
+        {
+            { 0x07f8f58c, 0x5f2e2218, 0xd49409d4, 0xe3555c9f, 0x1fb6a630, 0xb2aaa88d, 0xd352e03d, 0x68698245 },
+            { 0xb3b2a224, 0xe492f2e0, 0x2b551160, 0x7c6c9e06, 0x0d7f7b0e, 0x15eb8fe2, 0x58fc5992, 0x61fcef26 },
+            { 0x2a18187a, 0xdbb15d85, 0x86ddacd7, 0xf3e4aad3, 0x0ff6c482, 0x44bae281, 0x3daf01cf, 0x46cf4c47 },
+        },
+        {
+            { 0xf1498140, 0x213c6ea7, 0x392b4854, 0x7c1e7ef8, 0x5629ceba, 0x2488c38c, 0x0d8cc5bb, 0x1065aae5 },
+            { 0x9ec4e5f9, 0x426525ed, 0x16903303, 0x0e5eda01, 0xcbe5cadc, 0x72b1a7f2, 0x14eb5f40, 0x29387bcd },
+            { 0xdf200d57, 0x1c2c4525, 0xbfca674a, 0x5c3b2dd6, 0xe1834030, 0x0a07e7b1, 0x4f1ce716, 0x69a198e6 },
+        },
+    },
+    {
+        {
+            { 0xdcc5caed, 0xe1014434, 0x3c84fb33, 0x47ed5d96, 0xed86a0e7, 0x70019576, 0xd267f9e4, 0x25b2697b },
+            { 0xd91a78bc, 0x9062b2e0, 0xc8509667, 0x47c9889c, 0x405070b8, 0x9df54a66, 0x2493a1bf, 0x7369e6a9 },
+            { 0x13986864, 0x9d673ffb, 0x415dc7b8, 0x3ca5fbd9, 0xdf273b5e, 0xe04ecc3b, 0xb54e4cd2, 0x1420683d },
+        },
+        {
+            { 0xc1cc5ad0, 0x34eebb6f, 0x9646ac8b, 0x6a1b0ce9, 0xa66bde53, 0xd3b0da49, 0x61d081c1, 0x31e83b41 },
+            { 0x249dd197, 0xb478bd1e, 0x5e58c102, 0x620c3500, 0xccbaac5c, 0xfb02d32f, 0xf508a72d, 0x60b63beb },
+            { 0x9e062b4f, 0x97e8c712, 0x29320ad8, 0x49e48f4f, 0x6f18683f, 0x5bece14b, 0x2d550317, 0x55cf1eb6 },
+        },
+        {
+            { 0x7df58c52, 0x3076b5e3, 0xe799cc36, 0xd73ab9dd, 0x4913ee20, 0xbd831ce3, 0x62ba0133, 0x1a56fbaa },
+            { 0x65c23d58, 0x58791010, 0x5094819c, 0x8b9d086d, 0x12c55fa7, 0xe2402fa9, 0x570891d4, 0x669a6564 },
+            { 0x5c9dc9ec, 0x943e6b50, 0xa77c371a, 0x302557bb, 0x41347651, 0x9873ae56, 0x99c58a5c, 0x13c48367 },
+        },
+        {
+            { 0x5d8bd080, 0xc4dcfb6a, 0x571a4842, 0xdeebc4ec, 0xb8e55365, 0xd4b2e883, 0xc8e5b827, 0x50bdc87d },
+            { 0x5ab3e1b9, 0x423a5d46, 0xc7f13f61, 0xfc13c187, 0xecb5b9b6, 0x19f83664, 0xa637b607, 0x66f80c93 },
+            { 0x6edfe111, 0x606d3783, 0xf011abd9, 0x32353e15, 0x25b73b96, 0x64b03ac3, 0x725fd5ae, 0x1dd56444 },
+        },
+        {
+            { 0x08bac89a, 0xc297e600, 0xeae1c3e0, 0x7d4cea11, 0x9fe7977c, 0xf3e38be1, 0x63a305cd, 0x3a3a450f },
+            { 0x3362127d, 0x8fa47ff8, 0x71cd7c15, 0xbc9f6ac4, 0x49220c8b, 0x6e714543, 0x219f732e, 0x0e645912 },
+            { 0xd8394627, 0x078f2f31, 0xde94a510, 0x389d3183, 0x17996f80, 0xd1e36c6d, 0x93a9a87b, 0x318c8d93 },
+        },
+        {
+            { 0xab1dd398, 0x5d669e29, 0x342d9e3b, 0xfc921658, 0xf35973cd, 0x55851dfd, 0x25950af6, 0x509a41c3 },
+            { 0x2afffe19, 0xf2745d03, 0x7f24db66, 0x0c9f3c49, 0xba8598ef, 0xbc98d3e3, 0x9a1d5314, 0x224c7c67 },
+            { 0xa6f925e9, 0xbdc06edc, 0x641b1f33, 0x793ef3f4, 0x9d833e89, 0x82ec1280, 0x28a11389, 0x05bff023 },
+        },
+        {
+            { 0x0dc512e4, 0x6881a0dd, 0x44a5fafe, 0x4fe70dc8, 0x8f4a5240, 0x1f748e6b, 0xee01a3ea, 0x576277cd },
+            { 0x23cae00b, 0x36321370, 0xd1accf59, 0x544acf0a, 0xd21a1c88, 0x96741049, 0xfa2a44a7, 0x780b8cc3 },
+            { 0x234f305f, 0x1ef38abc, 0x1405de08, 0x9a577fbd, 0x34e62a0d, 0x5e82a514, 0x6271b7a1, 0x5ff41872 },
+        },
+        {
+            { 0x13b69540, 0xe5db47e8, 0x432610e1, 0xf35d2a3b, 0x38781276, 0xac1f26e9, 0xa0a0cb69, 0x29d4db8c },
+            { 0x1789db9d, 0x398e080c, 0xf3e778f5, 0xa7602025, 0x06bd035d, 0xfa98894c, 0x25a966be, 0x106a03dc },
+            { 0x333353d0, 0xd9ad0aaf, 0xacd309e5, 0x38669da5, 0xc888f7f0, 0x3c57658a, 0x052cbefa, 0x4ab38a51 },
+        },
+    },
+    {
+        {
+            { 0x5fddc09c, 0xd6cfd1ef, 0xf7575dce, 0xe82b3efd, 0x201634c2, 0x25d56b5d, 0x04ed2b9b, 0x3041c6bb },
+            { 0x6768d593, 0xda7c2b25, 0x4422ca13, 0x98c1c057, 0xca0ace1d, 0xf1a80bd5, 0xc088a690, 0x29cdd1ad },
+            { 0xd956e148, 0x0ff2f2f9, 0x9f356b2e, 0xade79775, 0x5f6c025c, 0x1a4698bb, 0x14049a7b, 0x104bbd68 },
+        },
+        {
+            { 0xd67ff163, 0xa95d9a5f, 0x4cc75681, 0xe92be69d, 0xde20f257, 0xb7f8024c, 0xfb072df5, 0x204f2a20 },
+            { 0x68f1ed67, 0x51f0fd31, 0xd86f3bc2, 0x2c811dcd, 0x04d2f2de, 0x44dc5c43, 0x092a7149, 0x5be8cc57 },
+            { 0x30ebb079, 0xc8143b3d, 0xbd652e30, 0x7589155a, 0x8f6d5c31, 0x653c3c31, 0xc279161f, 0x2570fb17 },
+        },
+        {
+            { 0x0bb8245a, 0x192ea955, 0x8f9050d1, 0xc8e6fba8, 0x88a4c935, 0x7986ea2d, 0xde018668, 0x241c5f91 },
+            { 0x2cb61575, 0x3efa367f, 0x1cd6026c, 0xf5f96f76, 0x65b52562, 0xe8c7142a, 0x53030acd, 0x3dcb65ea },
+            { 0x40de6caa, 0x28d81729, 0x22d9733a, 0x8fbf2cf0, 0x235b01d1, 0x16d7fcdd, 0x5fcdf0e5, 0x08420edd },
+        },
+        {
+            { 0x04f410ce, 0x0358c34e, 0x276e0685, 0xb6135b5a, 0xebb91521, 0x5d9670c7, 0x21db889c, 0x04d654f3 },
+            { 0x8362fa4a, 0xcdff20ab, 0xe21a3e6e, 0x57e118d4, 0xfc39e62b, 0xe3179617, 0xbc1769fd, 0x0d9a53ef },
+            { 0xddbdb5d5, 0x5e7dc116, 0x8da5dd2d, 0x2954deb6, 0x3334a292, 0x1cb60817, 0x18991ad7, 0x4a7a4f26 },
+        },
+        {
+            { 0xaf372a4b, 0x24c3b291, 0x718147f2, 0x93da8270, 0x86899ef2, 0xdd848564, 0x23e0ee33, 0x4a963142 },
+            { 0x5fb15f95, 0xf4a71802, 0x6b5c1b8f, 0x3df65f34, 0x00e01112, 0xcdfcf085, 0xddd31848, 0x11b50c4c },
+            { 0x08a4ffd6, 0xa6e82744, 0x9c1576d9, 0x738e177e, 0x3d02b3f2, 0x773348b6, 0xce6bcc51, 0x4f4bce4d },
+        },
+        {
+            { 0xc49d0b6f, 0x30e2616e, 0xcaec2317, 0xe456718f, 0xf26b4fa6, 0x48eb409b, 0x61595f37, 0x3042cee5 },
+            { 0xe2242584, 0xa71fce5a, 0x92f58a9e, 0x26ea7256, 0x1cea3cf4, 0xd21a09d7, 0xb71c01e6, 0x73fcdd14 },
+            { 0x449bac41, 0x427e7079, 0xbce2310a, 0x855ae36d, 0x5f841a7c, 0x4cae7621, 0x9a9ce1d6, 0x389e740c },
+        },
+        {
+            { 0x570eac28, 0xc9bd78f6, 0x27919ce1, 0xe55b0b32, 0xa19b91ed, 0x65fc3eab, 0xd6263690, 0x25c425e5 },
+            { 0x34dcb9ce, 0x64fcb3ae, 0xe348d0ad, 0x97500323, 0x62c6381b, 0x45b3f07d, 0x465a6788, 0x61545379 },
+            { 0xf1d7de6e, 0x3f3e06a6, 0x8e062308, 0x3ef97627, 0x4e8a6c77, 0x8c14f626, 0x15484759, 0x6539a089 },
+        },
+        {
+            { 0x14bb4a19, 0xddc4dbd4, 0x98424f8e, 0x19b2bc3c, 0x36ca7169, 0x48a89fd7, 0xf019bd90, 0x0f65320e },
+            { 0xc3d2f773, 0xe9d21f74, 0x25c46845, 0xc1505441, 0xf9b99e33, 0x624e5ce8, 0xc5cd186c, 0x11c5e4aa },
+            { 0xcafde0c6, 0xd486d1b1, 0x163b5181, 0x4f3fe6e3, 0xfaf2939a, 0x59a8af0d, 0xec33072a, 0x4cabc7bd },
+        },
+    },
+    {
+        {
+            { 0x3f78d289, 0xc08f788f, 0xa1404d9f, 0xfe30a72c, 0xcf65cc9d, 0xf2778bfc, 0x5acb2021, 0x7ee49816 },
+            { 0x089c0a2e, 0x239e9624, 0x3afe4738, 0xc748c4c0, 0x764fa12a, 0x17dbed2a, 0x321c8582, 0x639b93f0 },
+            { 0x9111a1c3, 0x7bd508e3, 0x80907489, 0x2b2b90d4, 0xae72fd19, 0xe7d2aec2, 0x85b602a6, 0x0edf493c },
+        },
+        {
+            { 0x84764113, 0x6767c4d2, 0xf7f5f835, 0xa090403f, 0xcae6bede, 0x1c8fcffa, 0xd1dfa369, 0x04c00c54 },
+            { 0x599b5a68, 0xaecc8158, 0xebade20e, 0xea574f0f, 0x22b67f07, 0x4fe41d74, 0x019d4fb4, 0x403b92e3 },
+            { 0x8b465cf8, 0x4dc22f81, 0x1480eff8, 0x71a0f35a, 0x04c7d657, 0xaee8bfad, 0xb26176f4, 0x355bb12a },
+        },
+        {
+            { 0x5a8c7318, 0xa301dac7, 0xb3ceaa11, 0xed90039d, 0x3bae3f2d, 0x6f077cbf, 0xe052ad8e, 0x7518eaf8 },
+            { 0x7493bbf4, 0xa71e64cc, 0xeca3b0c3, 0xe5bd84d9, 0xfa05e785, 0x0a6bc50c, 0x182ec312, 0x0f9b8132 },
+            { 0x1b7f6c32, 0xa48859c4, 0xf4383298, 0x0f2d60bc, 0xc9b1d1d9, 0x1815a929, 0xbb1755c4, 0x47c3871b },
+        },
+        {
+            { 0xc85066b0, 0xfbe65d50, 0xb3a299b0, 0x62ecc4b0, 0x441ae8e0, 0xe53754ea, 0xe8d48d5f, 0x08fea02c },
+            { 0x71ec4f48, 0x51445397, 0xc98c5d6e, 0xf805b17d, 0x47c3c66b, 0xf762c11a, 0x764699dc, 0x00b89b85 },
+            { 0x68deead0, 0x824ddd76, 0x4b685d23, 0xc8644520, 0x5d89d665, 0xb514cfcd, 0x4f75d537, 0x473829a7 },
+        },
+        {
+            { 0xad3902c9, 0x23d9533a, 0xef03588f, 0x64c2ddce, 0xcfe12fb4, 0x15257390, 0x44e4d390, 0x6c668b4d },
+            { 0x4679c418, 0x82d2da75, 0xb2618df0, 0xe63bd7d8, 0xac47eb0a, 0x355eef24, 0x4833c6b4, 0x2078684c },
+            { 0x7a78820c, 0x3b48cf21, 0x81273e97, 0xf76a0ab2, 0x8c8eed7b, 0xa96c65a7, 0x4f8a433f, 0x7411a605 },
+        },
+        {
+            { 0x18b175b4, 0x579ae53d, 0xf392a102, 0x68713159, 0x1eef35f5, 0x8455ecba, 0x458c398f, 0x1ec9a872 },
+            { 0xb99dc86d, 0x4d659d32, 0x603af115, 0x044cdc75, 0xdcc2e488, 0xb34c712c, 0xfb8134ff, 0x7c136574 },
+            { 0x00a2509b, 0xb8e6a4d4, 0x0bc882b4, 0x9b81d702, 0xf1957561, 0x57e7cc9b, 0xc7cd6460, 0x3add88a5 },
+        },
+        {
+            { 0x59393046, 0x85c298d4, 0x5ff659ec, 0x8f7e3598, 0xf2f66e3a, 0x1d2ca22a, 0xa406a720, 0x61ba1131 },
+            { 0xb635dcf2, 0xab895770, 0xf66c1fbc, 0x02dfef6c, 0xbeb6d187, 0x85530268, 0xcc879e74, 0x249929fc },
+            { 0x16959029, 0xa3d0a0f1, 0xba7ebd89, 0x023b6b6c, 0x26783307, 0x7bf15a3e, 0xbbd8ece7, 0x5620310c },
+        },
+        {
+            { 0x77e285d6, 0x6646b5f4, 0x6c8f6193, 0x40e8ff67, 0xabb594dd, 0xa6ec7311, 0x658cec4d, 0x7ec846f3 },
+            { 0x4934d643, 0x52899343, 0xa51222f5, 0xb9dbf806, 0xc3f41c22, 0x8f6d878f, 0x4d9d9730, 0x37676a2a },
+            { 0x1da22ec7, 0x9b5e8f3f, 0x6c01cd13, 0x130f1d77, 0xa2989fb8, 0x214c8fcf, 0x399b9dd5, 0x6daaf723 },
+        },
+    },
+    {
+        {
+            { 0xacad8ea2, 0x583b04bf, 0x148be884, 0x29b743e8, 0x0810c5db, 0x2b1e583b, 0x8eb3bbaa, 0x2b5449e5 },
+            { 0xeb3dbe47, 0x5f3a7562, 0x8ebda0b8, 0xf7ea3854, 0x45747299, 0x00c3e531, 0x1627d551, 0x1304e9e7 },
+            { 0x6adc9cfe, 0x789814d2, 0x8b48dd0b, 0x3c1bab3f, 0xf979c60a, 0xda0fe1ff, 0x7c2dd693, 0x4468de2d },
+        },
+        {
+            { 0xf86307ce, 0x4b9ad8c6, 0x435d0c28, 0x21113531, 0x657a772c, 0xd4a866c5, 0x63247352, 0x5da6427e },
+            { 0x9419469e, 0x51bb355e, 0x23ddc754, 0x33e6dc4c, 0x447f9962, 0x93a5b6d6, 0xfb44bd63, 0x6cce7c6f },
+            { 0xdeac22ca, 0x1a94c688, 0xbbae1ff8, 0xb9066ef7, 0x8d59580f, 0x88ad8c38, 0xe79f2ca8, 0x58f29abf },
+        },
+        {
+            { 0x710ecdf6, 0x4b5a64bf, 0x462c293c, 0xb14ce538, 0xd50b3ab9, 0x3643d056, 0x185b4870, 0x6af93724 },
+            { 0x8de73e68, 0xe90ecfab, 0x377e76a5, 0x54036f9f, 0xbe015982, 0xf0495b0b, 0xa7f41e36, 0x577629c4 },
+            { 0x09c6a888, 0x32200245, 0x4b558973, 0xd2e03613, 0x3c33289f, 0x83e23623, 0x0caec18f, 0x701f25bb },
+        },
+        {
+            { 0x7cbec113, 0x9d18f6d9, 0x74bfdbe4, 0x844a06e6, 0xac4e60d6, 0x20f5b522, 0x50955e51, 0x720a5bc0 },
+            { 0xe4616ced, 0xc3a8b0f8, 0x9e25a87d, 0xf700660e, 0xf4bca59c, 0x61e3061f, 0xbdc40be9, 0x2e0c92bf },
+            { 0x9b805a35, 0x0c3f0943, 0x6242abfc, 0xe84e8b37, 0x5c229346, 0x691417f3, 0x144ef0ec, 0x0e9b9cbb },
+        },
+        {
+            { 0x5db1beee, 0x8dee9bd5, 0x0a723fb9, 0xc9c3ab37, 0x1c68d791, 0x44a8f1bf, 0x1cfd3cde, 0x366d4419 },
+            { 0xfb5720ad, 0xfbbad48f, 0xdbf90d0e, 0xee81916b, 0x635543bf, 0xd4813152, 0x3f337bd8, 0x221104eb },
+            { 0xf2bc8c14, 0x9e3c1743, 0xb5856c3b, 0x2eda26fc, 0x68a7fb97, 0xccb82f0e, 0xbc593244, 0x4167a4e6 },
+        },
+        {
+            { 0xf8ce8fee, 0xc2be2665, 0xe880d62c, 0xe967ff14, 0x2f364eee, 0xf12e6e7e, 0xcb7ed2f6, 0x34b33370 },
+            { 0x76f62700, 0x643b9d28, 0x0e7668eb, 0x5d1d9d40, 0x21fc0684, 0x1b4b4303, 0x2255246a, 0x7938bb7e },
+            { 0x8681d6cc, 0xcdc591ee, 0xed85a753, 0xce02109c, 0x58808883, 0xed7485c1, 0x2dfe65e4, 0x1176fc6e },
+        },
+        {
+            { 0x49770eb8, 0xdb90e289, 0xacf440a3, 0x98fbcc2a, 0xded7879b, 0x21354ffe, 0xf26906b6, 0x1f6a3e54 },
+            { 0x5b9c619b, 0xb4af6cd0, 0xb2a58480, 0x2ddfc9f4, 0xebe94dc4, 0x3d4fa502, 0x677d5f34, 0x08fc3a4c },
+            { 0xd30734ea, 0x60a4c199, 0x31165cd6, 0x40c085b6, 0xf7598295, 0xe2333e23, 0x16b900d1, 0x4f2fad01 },
+        },
+        {
+            { 0xb73bb638, 0x962cd91d, 0xfc129c08, 0xe60577aa, 0xf3b61689, 0x6f619b39, 0x2944ee81, 0x3451995f },
+            { 0x94ae4e54, 0x44beb241, 0x1857ef6c, 0x5f541c51, 0x368d0498, 0xa61e6b2d, 0x972ef7ab, 0x445484a4 },
+            { 0x9fea7d7c, 0x9152fcd0, 0xb0935cf6, 0x4a816c94, 0x47285c40, 0x258e9aaa, 0x042893b7, 0x10b89ca6 },
+        },
+    },
+    {
+        {
+            { 0x5a45f06e, 0x753941be, 0x6d9c5f65, 0xd07caeed, 0x72ff51b6, 0x11776b9c, 0xef0d4da9, 0x17d2d1d9 },
+            { 0x9718289c, 0x3d594749, 0x24533f26, 0x12ebf8c5, 0x14c3ef15, 0x0262bfcb, 0x77b7518e, 0x20b878d5 },
+            { 0x073f3e6a, 0x27f2af18, 0xd7521069, 0xfd3fe519, 0x3ca60022, 0x22e3b72c, 0xcc65c6a7, 0x72214f63 },
+        },
+        {
+            { 0xf43b29c9, 0x1d9db7b9, 0x4f518f75, 0xd605824a, 0x312f9dc4, 0xf2c072bd, 0x5a1545b0, 0x1f24ac85 },
+            { 0x5307a693, 0xb4e37f40, 0x2f336795, 0xaba714d7, 0x73761099, 0xd6fbd0a7, 0x8171cbc9, 0x5fdf48c5 },
+            { 0x8e9505aa, 0x24d60832, 0x0c1420ee, 0x4748c1d1, 0x06fb25a2, 0xc7ffe45c, 0x2ae395e6, 0x00ba739e },
+        },
+        {
+            { 0xea88bb26, 0xae4426f5, 0x84973bfb, 0x360679d9, 0x26694e50, 0x5c9f030c, 0xd518d226, 0x72297de7 },
+            { 0x5c8790d6, 0x592e98de, 0x45c2a2df, 0xe5bfb7d3, 0xf9b49922, 0x115a3b60, 0x67ad78f3, 0x03283a3e },
+            { 0xbe0cb939, 0x48241dc7, 0x8b633080, 0x32f19b4d, 0x02289308, 0xd3dfc90d, 0x46271945, 0x05e12968 },
+        },
+        {
+            { 0x242c4550, 0xadbfbbc8, 0xd03081d9, 0xbcc80cec, 0xf5c8df92, 0x843566a6, 0x8258ce4c, 0x78cf25d3 },
+            { 0x2d9c495a, 0xba82eeb3, 0xf12bb97c, 0xceefc8fc, 0x93b5d1e0, 0xb02dabae, 0x13698d9b, 0x39c00c9c },
+            { 0x31489d68, 0x15ae6b8e, 0x9c2bf087, 0xaa851cab, 0xf04efa05, 0xc9a75a97, 0x6b3ff832, 0x006b5207 },
+        },
+        {
+            { 0xb9ce082d, 0xf5cb7e16, 0x417abc29, 0x3407f14c, 0x2bf4a7ab, 0xd4b36bce, 0x1a9f75ce, 0x7de2e956 },
+            { 0x9d95781c, 0x29e0cfe1, 0x966310e2, 0xb681df18, 0x70516b39, 0x57df39d3, 0x3bc76122, 0x4d57e344 },
+            { 0xb6a55ecb, 0xde70d4f4, 0x5d85db99, 0x4801527f, 0xd3ee9a81, 0xdbc9c440, 0x1a6029ed, 0x6b2a90af },
+        },
+        {
+            { 0x5bb2d80a, 0x77ebf324, 0x2fb9079b, 0xd8301b47, 0x4cee7333, 0xc647e6f2, 0x276c2109, 0x465812c8 },
+            { 0x9ae61e97, 0x6923f4fc, 0xe03f5fd1, 0x5735281d, 0xe6edd12d, 0xa764ae43, 0xd12d3e4a, 0x5fd8f4e9 },
+            { 0x2a1062d9, 0x4d43beb2, 0x3831dc16, 0x7065fb75, 0xde2968d7, 0x180d4a7b, 0x1cb16790, 0x05b32c2b },
+        },
+        {
+            { 0x7ad58195, 0xf7fca42c, 0x4333f3cc, 0x3214286e, 0x340b979d, 0xb6c29d0d, 0x567307e1, 0x31771a48 },
+            { 0xd24da8fd, 0xc8c05ecc, 0x05dfef83, 0xa1cf1aac, 0x7df9cd61, 0xdbbeeff2, 0x7b471e99, 0x3b5556a3 },
+            { 0xe14dd482, 0x32b0c524, 0x1a2ba4b6, 0xedb35154, 0x282b5af3, 0xa3d16048, 0x7a7336eb, 0x4fc079d2 },
+        },
+        {
+            { 0x0c86c50d, 0xdc348b44, 0xcc94e651, 0x1337cbc9, 0x643e3cb9, 0x6422f74d, 0xbae3cd08, 0x241170c2 },
+            { 0x89bf2f7f, 0x51c938b0, 0x02dfe9a7, 0x2497bd65, 0x7880e453, 0xffffc09c, 0xcaf98e92, 0x124567ce },
+            { 0x0ac473b4, 0x3ff9ab86, 0x0113e435, 0xf0911dee, 0xebc6c4af, 0x4ae75060, 0x6c87000d, 0x3f861296 },
+        },
+    },
+    {
+        {
+            { 0x36048d13, 0x9c18fcfa, 0x73899ddd, 0x29159db3, 0x9f92d0aa, 0xdc9f350b, 0x878a19d4, 0x26f57eee },
+            { 0x782a0dde, 0x559a0cc9, 0xea718385, 0x551dcdb2, 0x31ef238c, 0x7f62865b, 0x7973613d, 0x504aa776 },
+            { 0x5687efb1, 0x0cab2cd5, 0x247af17b, 0x5180d162, 0x4f5a2467, 0x85c15a34, 0x9dba3069, 0x4041943d },
+        },
+        {
+            { 0xa26caadd, 0x4b217743, 0x648ab7ce, 0x47a6b424, 0x03fbc9e3, 0xcb1d4f7a, 0x9800d019, 0x12d93142 },
+            { 0x43ebcc96, 0xc3c0eeba, 0x26ea9caf, 0x8d749c9c, 0x1c77ccc6, 0xd9fa95ee, 0x7684340f, 0x1420a1d9 },
+            { 0xd337594f, 0x00c67799, 0xb23aa47b, 0x5e3c5140, 0xe35ff395, 0x44182854, 0x4359a012, 0x1b4f9231 },
+        },
+        {
+            { 0xa49866b1, 0x33cf3030, 0x215f4859, 0x251f73d2, 0x51def4f6, 0xab82aa40, 0x6f9a23f6, 0x5ff191d5 },
+            { 0x89150951, 0x3e5c109d, 0x2de9696a, 0x39cefa91, 0x975f3020, 0x20eae43f, 0x7f132dae, 0x239b572a },
+            { 0xac2d9068, 0x819ed433, 0x5fc98523, 0x2883ab79, 0x5593eb3d, 0xef457280, 0x758f36cb, 0x020c526a },
+        },
+        {
+            { 0xf042cc89, 0xe931ef59, 0x8e124bb6, 0x2c589c9d, 0xaec75997, 0xadc8e18a, 0x5602c50c, 0x452cfe0a },
+            { 0x9ed8dbbc, 0x779834f8, 0xdc7ca46c, 0xc8f2aaf9, 0xa3e1b074, 0xa9524cdc, 0x15313877, 0x02aacc46 },
+            { 0x647877df, 0x86a0f7a0, 0x0e607c9f, 0xbbc46427, 0xf1fb11c9, 0xab17ea25, 0x304b877b, 0x4cfb7d7b },
+        },
+        {
+            { 0x9789ef12, 0xe28699c2, 0xdf57190d, 0x2b6ecd71, 0xecc970d0, 0xc343c857, 0x434d3ac5, 0x5b1d4cbc },
+            { 0xb89b75fe, 0x72b43d6c, 0x9c6adc80, 0x54c694d9, 0x3ee34c9f, 0xb8c3aa37, 0x39075364, 0x14b4622b },
+            { 0xcc0a9f26, 0xb6fb2615, 0xb88dcce5, 0x3a4f0e2b, 0x3369a705, 0x1301498b, 0x58592dd1, 0x2f98f712 },
+        },
+        {
+            { 0x4f54a701, 0x2e12ae44, 0xa9cbd7de, 0xfcfe3ef0, 0x75835de0, 0xcebf890d, 0xe7614554, 0x1d8062e9 },
+            { 0xb50f9e56, 0x0c94a74c, 0x8e8e1320, 0x5b1ff4a9, 0x82300f67, 0x9a2acc21, 0xd806aaf9, 0x3a6ae249 },
+            { 0xa9907c5a, 0x657ada85, 0x91b90f62, 0x1a0ea8b5, 0xdf34b4e9, 0x8d0e1dfb, 0xaef25ff3, 0x298b8ce8 },
+        },
+        {
+            { 0x0a2165de, 0x837a72ea, 0x0bcf79f6, 0x3fab07b4, 0x7738ae70, 0x521636c7, 0x03a7d7dc, 0x6ba62718 },
+            { 0xeff70cb2, 0x2a927953, 0x79157076, 0x4b89c92a, 0x30a7cf6a, 0x9418457a, 0x4d5ce485, 0x34b8a840 },
+            { 0x83693335, 0xc26eecb5, 0x63b5fefd, 0xd5a813df, 0xa4b22573, 0xa293aa9a, 0x465e1c6a, 0x71d62bdd },
+        },
+        {
+            { 0xb1f75ef5, 0xcd2db5da, 0x16b065f5, 0xd77f95cf, 0x3f49f085, 0x14571fea, 0x262b2b3d, 0x1c333621 },
+            { 0xd378df80, 0x6533cc28, 0x0a0fa4b4, 0xf6db4379, 0xf701da5a, 0xe3645ff9, 0xf3172ba4, 0x74d5f317 },
+            { 0x67d9ca81, 0xa86fe554, 0x2b298c37, 0x398b7c75, 0xe3ac623b, 0xda6d0892, 0x47e9d98c, 0x4aebcc45 },
+        },
+    },
+    {
+        {
+            { 0x7354b610, 0x0b408d9e, 0x5ba85b6e, 0x806b3253, 0x4a58a207, 0xdbe63a03, 0xc9a1df2c, 0x173bd9dd },
+            { 0x276d01c9, 0x12f0071b, 0x86c48c70, 0xe7b8bac5, 0x71d6fba9, 0x5308129b, 0x5a3db792, 0x5d88fbf9 },
+            { 0xfe5872df, 0x2b500f1e, 0xd43918c1, 0x58d6582e, 0xc9673ae0, 0xe6ed278e, 0xb19ea319, 0x06e1cd13 },
+        },
+        {
+            { 0x9e5b0353, 0x472baf62, 0x278d0447, 0x3baa0b90, 0x9643bf27, 0x0c785f46, 0x8d837b13, 0x7f3a6a1a },
+            { 0x6f166f23, 0x40d0ad51, 0x1fab6abe, 0x118e3293, 0xa04d088e, 0x3fe35e14, 0x26e16266, 0x30806035 },
+            { 0x5d3d800b, 0xf7e64439, 0xc901edf6, 0x95a8d555, 0x592c6339, 0x68cd7830, 0x2e51307e, 0x30d0fded },
+        },
+        {
+            { 0x68b84750, 0x9cb4971e, 0x6664bbcf, 0xa0957229, 0x72fa412b, 0x5c8de726, 0x51c589d9, 0x46150843 },
+            { 0xf21233b3, 0xe0594d1a, 0xf0cc4d9c, 0x1bdbe78e, 0x8f499a77, 0x6965187f, 0x2c099868, 0x0a921420 },
+            { 0xaeb9a02e, 0xbc9019c0, 0x16034cae, 0x55c7110d, 0x659932ec, 0x0e6df501, 0x95ca5dfe, 0x3bca0d28 },
+        },
+        {
+            { 0x9ecc01bf, 0x9c688eb6, 0xa644896f, 0xf0bc83ad, 0x5f7a9fe2, 0xca2d955f, 0x8df28241, 0x4ea8b403 },
+            { 0x3c5d62a4, 0x40f031bc, 0xcff07a60, 0x19fc8b3e, 0x130fb545, 0x98183da2, 0xae8f13cd, 0x5631dedd },
+            { 0xf1cad202, 0x2aed460a, 0xa48cee83, 0x46305305, 0x49f11a5f, 0x91217745, 0x542ca463, 0x24ce0930 },
+        },
+        {
+            { 0xfdf30b85, 0x3fcfa155, 0x36372ea4, 0xd2f7168e, 0x6492f844, 0xb2e064de, 0x324f4280, 0x549928a7 },
+            { 0xfd06c106, 0x1fe890f5, 0x5d8810f2, 0xb5c46835, 0x6e8caf3e, 0x827808fe, 0x8a06d74b, 0x41d4e3c2 },
+            { 0x63ee1a2e, 0xf26e32a7, 0xd25ffdea, 0xae91e4b7, 0xd17f4d69, 0xbc3bd33b, 0xc0dcff6a, 0x491b66de },
+        },
+        {
+            { 0xd0da64a1, 0x75f04a8e, 0x67e2284b, 0xed222caf, 0x1f7b7ba4, 0x8234a379, 0xb7018b67, 0x4cf6b8b0 },
+            { 0xc7ea32a7, 0x98f5b13d, 0x7e16db98, 0xe3d5f8cc, 0xcbf8d947, 0xac0abf52, 0xc85ee4ac, 0x08f338d0 },
+            { 0x991a73bd, 0xc383a821, 0xdf320c7a, 0xab27bc01, 0x84777063, 0xc13d331b, 0xeb078a99, 0x530d4a82 },
+        },
+        {
+            { 0x6c9abf9e, 0x6d697345, 0x4900a880, 0x257fb2fc, 0xc8cfb850, 0x2bacf412, 0x0cbfbd5b, 0x0db3e7e0 },
+            { 0xe1f94825, 0x004c3630, 0x8cab535a, 0x7e2d7826, 0xcc84ff8b, 0xc7482323, 0x101770b9, 0x65ea753f },
+            { 0xe2096363, 0x3d66fc3e, 0x61b5cb6b, 0x81d62c7f, 0x13443b1a, 0x0fbe0442, 0x21e1a1db, 0x02a4ec19 },
+        },
+        {
+            { 0xf1cf795f, 0xf5c86162, 0x26ee57f2, 0x118c8619, 0x1c063578, 0x17212485, 0xec067fcf, 0x36d12b5d },
+            { 0x3b24b8a2, 0x5ce6259a, 0x45afa0b8, 0xb8577acc, 0x8ba07037, 0xcccbe6e8, 0x127809bf, 0x3d143c51 },
+            { 0x79154557, 0x126d2791, 0xfc783a0a, 0xd5e48f5c, 0xdf179bac, 0x36bdb6e8, 0x5ba82859, 0x2ef51788 },
+        },
+    },
+    {
+        {
+            { 0x305b2f51, 0x96eebffb, 0x889596b8, 0xd3f938ad, 0x46d5dd25, 0xf0f52dc7, 0xbb3a0095, 0x57968290 },
+            { 0x8c58aedc, 0x4637974e, 0xabf041a4, 0xb9ef22fb, 0xe980718a, 0xe185d956, 0xb143a8a6, 0x2f1b78fa },
+            { 0x0a20e101, 0xf71ab843, 0x24f0ec47, 0xf393658d, 0x6ee2eed1, 0xcf7509a8, 0xdc2aa3e1, 0x7dc43e35 },
+        },
+        {
+            { 0x273e9718, 0x5a782a5c, 0x5e4efd94, 0x3576c699, 0x1f237d3e, 0x0f2ed805, 0x82d50a99, 0x044fb81d },
+            { 0x887dd9c3, 0x85966665, 0x4bb05355, 0xc90f9b31, 0xef2079b1, 0xc6e08df8, 0x758cc12f, 0x7ef72016 },
+            { 0xa907e3d9, 0xc1df18c5, 0xce4c6359, 0x57b3371d, 0xb201bb49, 0xca704534, 0x9c30dd2e, 0x7f79823f },
+        },
+        {
+            { 0x68f587ba, 0x6a9c1ff0, 0x0050c8de, 0x0827894e, 0x7ded5be7, 0x3cbf9955, 0x1c06d6f0, 0x64a9b043 },
+            { 0xa3b513e8, 0x8334d239, 0xb91fa8d8, 0xc13670d4, 0xf590bd33, 0x12b54136, 0xd784d9b4, 0x0a4e0373 },
+            { 0x5b7d2919, 0x2eb3d6a1, 0xd53a8235, 0xb0b4f6a0, 0x89a45d47, 0x7156ce43, 0xce18346c, 0x071a7d0a },
+        },
+        {
+            { 0x20e14431, 0xcc0c3552, 0x09b15141, 0x0d659507, 0x209d5f36, 0x9af5621b, 0x617755d3, 0x7c69bcf7 },
+            { 0xc887ba0b, 0xd3072daa, 0xbfa562ee, 0x01262905, 0xc0ef768b, 0xcf543002, 0x46ea7e9c, 0x2c3bcc71 },
+            { 0x04e8295f, 0x07f0d7eb, 0x2f50f37d, 0x10db1825, 0x171798d7, 0xe951a9a3, 0x22aca51d, 0x6f5a9a73 },
+        },
+        {
+            { 0xa3d944be, 0xe729d4eb, 0x8078af9e, 0x8d9e0940, 0x47869c03, 0x4525567a, 0xee8d3b24, 0x02ab9680 },
+            { 0x2f41c6c5, 0x8ba1000c, 0x0cfefb9b, 0xc49f79c1, 0x3cc51c9f, 0x4efa4770, 0xe147afca, 0x494e21a2 },
+            { 0xdde50d9a, 0xefa48a85, 0x0fb9a249, 0x219a224e, 0xd91ef6d9, 0xfa091f1d, 0xea46bb34, 0x6b5d76cb },
+        },
+        {
+            { 0x1e782522, 0xe0f94117, 0x036936d3, 0xf1e6ae74, 0xd0fcc746, 0x408b3ea2, 0x03dd313e, 0x16fb869c },
+            { 0xec0cd994, 0x8857556c, 0x5cd01dba, 0x6472dc6f, 0x8f42b477, 0xaf016914, 0x85277354, 0x0ae333f6 },
+            { 0x33b60962, 0x288e1997, 0xd8abe133, 0x24fc72b4, 0x0991d03e, 0x4811f7ed, 0x8f70d075, 0x3f81e38b },
+        },
+        {
+            { 0x5f17c824, 0x0adb7f35, 0xd74299a4, 0x74b923c3, 0xcbf8eaf7, 0xd57c3e8b, 0x4cdedc3d, 0x0ad3e2d3 },
+            { 0x7ed9affe, 0x7f910fcc, 0x2465874b, 0x545cb8a1, 0x4b0c4704, 0xa8397ed2, 0x04f50993, 0x50510fc1 },
+            { 0x336e249d, 0x6f0c0fc5, 0xc331cfd9, 0x745ede19, 0x09eefe1c, 0xf2d6fd00, 0xf0fa1ebe, 0x127c158b },
+        },
+        {
+            { 0xae51b974, 0xdea28fc4, 0x744dfe96, 0x1d9973d3, 0x873848a8, 0x6240680b, 0xd167df95, 0x4ed82479 },
+            { 0x2e9879a2, 0xf6197c42, 0x52ca3647, 0xa44addd4, 0x4b4eaccb, 0x9b413fc1, 0x07ef4f68, 0x354ef87d },
+            { 0x60c5d975, 0xfee3b522, 0xeb41b0b8, 0x50352efc, 0xa9f6653c, 0x8808ac30, 0x0539236d, 0x302d92d2 },
+        },
+    },
+    {
+        {
+            { 0xe4e0f177, 0x2dbc6fb6, 0xa4bd6a93, 0x04e1bf29, 0x787af6e8, 0x5e1966d4, 0xb426d060, 0x0edc5f5e },
+            { 0xbca4283d, 0x7813c1a2, 0xa1863dd9, 0xed62f091, 0xc268fa86, 0xaec7bcb8, 0x6f1cae4c, 0x10e5d3b7 },
+            { 0x53da8e67, 0x5453bfd6, 0x24a9f641, 0xe9dc1eec, 0x03578a23, 0xbf87263b, 0x361cba72, 0x45b46c51 },
+        },
+        {
+            { 0x8a7fe3e4, 0xce9d4ddd, 0x76620e30, 0xab136456, 0xb30e9958, 0x4b594f7b, 0x321229df, 0x5c1c0aef },
+            { 0x314f7fa1, 0xa9402abf, 0x8e8cf450, 0xe257f1dc, 0x23a8be84, 0x1dbbd54b, 0x6dcb713b, 0x2177bfa3 },
+            { 0xfa79db8f, 0x37081bbc, 0xc25f59b3, 0x6048811e, 0x9c832487, 0x087a7665, 0x7d8ab5bb, 0x4ae61938 },
+        },
+        {
+            { 0x985bfb83, 0x61117e44, 0x71963136, 0xfce0462a, 0xd425904b, 0x83ac3448, 0x5ba43d64, 0x75685abe },
+            { 0x5344a32e, 0x8ddbf6aa, 0xb41b4078, 0x7d88eab4, 0x4a130d60, 0x5eb0eb97, 0x17bf3e03, 0x1a00d91b },
+            { 0xeb61f2b2, 0x6e960933, 0xc9ff4952, 0x543d0fa8, 0x7af66569, 0xdf727510, 0x23b0e6aa, 0x135529b6 },
+        },
+        {
+            { 0xe22e83fe, 0xf5c716bc, 0xe80985c1, 0xb42beb19, 0x14254aae, 0xec9da637, 0x1590a613, 0x5972ea05 },
+            { 0xadd1d518, 0x18f0dbd7, 0xcfc11f11, 0x979f7888, 0x7114759b, 0x8732e1f0, 0x65ca3a01, 0x79b5b81a },
+            { 0xdc8f7811, 0x0fd4ac20, 0xac4d4fa8, 0x9a9ad294, 0xb3360434, 0xc01b2d64, 0x905f3bdb, 0x4f7e9c95 },
+        },
+        {
+            { 0x355299fe, 0x71c8443d, 0xdbebead7, 0x8bcd3b1c, 0xf1a49466, 0x8092499e, 0xa144adc8, 0x1942eec4 },
+            { 0x5781302e, 0x62674bbc, 0x89addc0f, 0xd8520f39, 0x53fbd9c6, 0x8c2999ae, 0x2e638e4c, 0x31993ad9 },
+            { 0xae234992, 0x7dac5319, 0x0cea3e92, 0x2c1b3d91, 0x253c1122, 0x553ce494, 0x4ef9ca75, 0x2a0a6531 },
+        },
+        {
+            { 0x3c1c793a, 0xcf361acd, 0x5a35bc3b, 0x2f9ebcac, 0xa8cda6ab, 0x60e860e9, 0x6dea1a13, 0x055dc39b },
+            { 0xf7f927c2, 0x2db7937f, 0x17d0a635, 0xdb741f06, 0x1155af76, 0x5982f3a2, 0x647c2ded, 0x4cf6e218 },
+            { 0xc28d5bb6, 0xb119227c, 0x774dffab, 0x07e24ebc, 0xe4a32c89, 0xa83c78ce, 0x10aa24b6, 0x121a3077 },
+        },
+        {
+            { 0xc77483c9, 0xd659713e, 0xb82b96af, 0x88bfe077, 0x1097bcd3, 0x289e2823, 0x6ced3a9b, 0x527bb94a },
+            { 0x9f034a97, 0xe4db5d5e, 0x3034bc2d, 0xe153fc09, 0x9551d3b1, 0x46054691, 0x7a40e52d, 0x333fc76c },
+            { 0x995b482e, 0x563d992a, 0x6e383801, 0x3405d07c, 0x2f64d8e5, 0x485035de, 0x20a7a9f7, 0x6b89069b },
+        },
+        {
+            { 0xb5c7db77, 0x4082fa8c, 0xc734c155, 0x068686f8, 0xf6e7a57e, 0x29e6c8d9, 0xa7639bcf, 0x0473d308 },
+            { 0x6270220d, 0x812aa041, 0xf9245b4e, 0x995a89fa, 0x5072ef05, 0xffadc4ce, 0xaa73eb73, 0x23bc2103 },
+            { 0x03589e05, 0xcaee7926, 0x46dcc492, 0x2b4b4212, 0xe601a94f, 0x02a1ef74, 0xde04341a, 0x102f73bf },
+        },
+    },
+    {
+        {
+            { 0xb5511c9a, 0xa2b4dae0, 0x2bffff06, 0x7ac86029, 0xf5504234, 0x981f375d, 0xda4ea12d, 0x3f6bd725 },
+            { 0x7f5745c6, 0xeb18b9ab, 0x5787c690, 0x023a8aee, 0x2df7afa9, 0xb72712da, 0xea5c013d, 0x36597d25 },
+            { 0x106058ac, 0x734d8d7b, 0x6fc6905f, 0xd940579e, 0x9202932d, 0x6466f8f9, 0xda60d6d0, 0x7b7ecc19 },
+        },
+        {
+            { 0xa77cfa9b, 0x6dae4a51, 0xe7a38650, 0x82263654, 0x8f2d82db, 0x09bbffcd, 0x1bf5caba, 0x03bedc66 },
+            { 0x695c690d, 0x78c2373c, 0x0642906e, 0xdd252e66, 0x4ae12bd2, 0x951d4444, 0x01743956, 0x4235ad76 },
+            { 0x078975f5, 0x6258cb0d, 0x9189f298, 0x49294254, 0xe2e36ee4, 0xa0cab423, 0xcdf066a1, 0x0e7ce2b0 },
+        },
+        {
+            { 0xd94b70f9, 0xfea6fedf, 0xc1fcba2d, 0xf130c051, 0x7f2fab89, 0x4882d47e, 0x8aeceeb5, 0x61525613 },
+            { 0xc48c85a3, 0xc494643a, 0x3c6139ad, 0xfd361df4, 0x3ae94d48, 0x09db17dd, 0x8fb4674a, 0x666e0a5d },
+            { 0x4870cb0d, 0x2abbf64e, 0xaa458b6b, 0xcd65bcf0, 0x75e8985d, 0x9abe4eba, 0xd514dee4, 0x7f0bc810 },
+        },
+        {
+            { 0x737213a0, 0x83ac9dad, 0x2ef72e98, 0x9ff6f8ba, 0x43ec6957, 0x311e2edd, 0xdec5ab75, 0x1d3a907d },
+            { 0x26f4136f, 0xb9006ba4, 0x57e03035, 0x8d67369e, 0x4f463c28, 0xcbc8dfd9, 0xf8eedbf5, 0x0d1f8dbc },
+            { 0x3ed081dc, 0xba169331, 0x851b3480, 0x29329fad, 0x030321cb, 0x0128013c, 0xa31bfde3, 0x00011b44 },
+        },
+        {
+            { 0x6a0aa75c, 0x16561f69, 0x5852bd6a, 0xc1bf725c, 0x9a7966ad, 0x11a8dd7f, 0xd2851026, 0x63d988a2 },
+            { 0x3fc66c0c, 0x3fdfa06c, 0x4dd60dd2, 0x5d40e38e, 0x268e4d71, 0x7ae38b38, 0x6e8357e1, 0x3ac48d91 },
+            { 0xafbd232e, 0x00120753, 0xfdd8f683, 0xe92bceb8, 0x84e72b91, 0xf81669b3, 0x2368a066, 0x33fad52b },
+        },
+        {
+            { 0xc422cfe8, 0x8d2cc8d0, 0x05a13acb, 0x072b4f7b, 0xecf6a56f, 0xa3feb6e6, 0xb90a71e2, 0x3cc355cc },
+            { 0xc5e41e16, 0x540649c6, 0x333f7735, 0x0af86430, 0xf305e746, 0xb2acfcd2, 0xa256dca7, 0x16c0f429 },
+            { 0x903e9131, 0xe9b69443, 0x7a5637ce, 0xb8a494cb, 0xbaba9244, 0xc87cd1a4, 0x6bae7568, 0x631eaf42 },
+        },
+        {
+            { 0xa3700de8, 0x47d975b9, 0xe2f80552, 0x7280c5fb, 0x32e45de1, 0x53658f27, 0x665f80b5, 0x431f2c7f },
+            { 0xda66fe9f, 0xb3e90410, 0x6c16e5a6, 0x85dd4b52, 0x1ef9bf83, 0xbc3d9761, 0x1ea919b5, 0x5599648b },
+            { 0x858f7b19, 0xd6026344, 0xa1ea514a, 0x14ab352f, 0x2090a9d7, 0x8900441a, 0x91253b26, 0x7b04715f },
+        },
+        {
+            { 0xc4e6bac6, 0xb376c280, 0x6d1d9b0b, 0x970ed3dd, 0x450bf944, 0xb09a9558, 0x57cde223, 0x48d0acfa },
+            { 0xacf6ae43, 0x83edbd28, 0x7d5c7ab4, 0x86357c8b, 0xb7eb2c44, 0xc0404769, 0xc2f6583f, 0x59b37bf5 },
+            { 0x7dabe671, 0xb60f26e4, 0x622f3a37, 0xf1d1a197, 0xe9960394, 0x4208ce7e, 0x336d3bdb, 0x16234191 },
+        },
+    },
+    {
+        {
+            { 0x1ff38640, 0xdd499cd6, 0x063625a0, 0x29cd9bc3, 0x3dd73dc3, 0x51e2d802, 0x203b9231, 0x4a25707a },
+            { 0xf6267ff6, 0xb9e499de, 0x742c0843, 0x7772ca7b, 0xe9a4f2b1, 0x23a0153f, 0xd5d05006, 0x2cdfdfec },
+            { 0x53f6ed6a, 0x2ab7668a, 0x1dd170a1, 0x30424258, 0x3ae20161, 0x4000144c, 0x248e49fc, 0x5721896d },
+        },
+        {
+            { 0xa1d0da4e, 0x285d5091, 0xb5fe3e08, 0x4baa6fa7, 0xe19393b3, 0x63e5177c, 0xc4b030fd, 0x03c935af },
+            { 0xfd181bae, 0x0b6e5517, 0x2bb963b4, 0x9022629f, 0x32064625, 0x5509bce9, 0xf63c13da, 0x578edd74 },
+            { 0x492b0c3d, 0x997276c6, 0xdfe205fc, 0x47ccc2c4, 0xdd623a3c, 0xdcd29b84, 0x0288c7a2, 0x3ec2ab59 },
+        },
+        {
+            { 0xae32d1cb, 0xa7213a09, 0x40f5c2d5, 0x0f2b87df, 0xe81eab29, 0x0baea4c6, 0x6adbac5e, 0x0e1bf66c },
+            { 0xe4d87bb9, 0xa1a0d27b, 0x61391aed, 0xa98b4deb, 0x73cb9b83, 0x99a0ddd0, 0x200fcace, 0x2dd5c25a },
+            { 0x792c887e, 0xe2abd5e9, 0xcb926d5d, 0x1a020018, 0xbaae5f1e, 0xbfba69cd, 0x5ae88f5f, 0x730548b3 },
+        },
+        {
+            { 0xa1d6e334, 0x805b094b, 0x09353f19, 0xbf3ef177, 0x0622702b, 0x423f06cb, 0xd87845dd, 0x585a2277 },
+            { 0xcba8b8ee, 0xc43551a3, 0xb2115f16, 0x65a26f1d, 0xab8c3850, 0x760f4f52, 0x411db8ca, 0x3043443b },
+            { 0x33d48962, 0xa18a5f82, 0xec78257f, 0x6698c4b5, 0x373e41ff, 0xa78e6fa5, 0x50ef981f, 0x76562789 },
+        },
+        {
+            { 0xea86cf9d, 0xe17073a3, 0x07155fdc, 0x3a8cfbb7, 0x31838a8e, 0x4853e7fc, 0xb613f616, 0x28bbf484 },
+            { 0xd51fc8c0, 0x38c3cf59, 0x0506b6f2, 0x9bedd2fd, 0xab570e8f, 0x26bf109f, 0xc1b846a6, 0x3f4160a8 },
+            { 0x6f136c7c, 0xf2612f5c, 0xf6dd11be, 0xafead107, 0x13de6f33, 0x527e9ad2, 0x8188f75d, 0x1e79cb35 },
+        },
+        {
+            { 0xf5e08181, 0x77e953d8, 0x299dded9, 0x84a50c44, 0x864525e5, 0xdc6c2d0c, 0x39d1f2f4, 0x478ab52d },
+            { 0xeef7e3f1, 0x013436c3, 0xfe9e10f8, 0x828b6a7f, 0xbcf9defc, 0x7ff908e5, 0x3a3b3831, 0x65d7951b },
+            { 0x9252d159, 0x66a6a4d3, 0x871ac807, 0xe5dde1bc, 0xa6c1c96f, 0xb82c6b40, 0x1a212214, 0x16d87a41 },
+        },
+        {
+            { 0xd54e0583, 0xfba4d5e2, 0x2ebd99fa, 0xe21fafd7, 0x6ee9778f, 0x497ac273, 0x7a5a6dde, 0x1f990b57 },
+            { 0x42066215, 0xb3bd7e5a, 0x0c5a24c1, 0x879be3cd, 0xd6f994b7, 0x57c05db1, 0x65f38ca6, 0x28f87c81 },
+            { 0x1be8f7d6, 0xa3344ead, 0xacea798f, 0x7d1e50eb, 0x520de052, 0x77c6569e, 0x534d6d3e, 0x45882fe1 },
+        },
+        {
+            { 0x943c6fe4, 0xd8ac9929, 0xa38392a2, 0xb5f9f161, 0xbec89af3, 0x2699db13, 0xe405f074, 0x7dcf843c },
+            { 0x757983d6, 0x6669345d, 0x17aa11a6, 0x62b6ed11, 0x985e128f, 0x7ddd1857, 0xf626f6dd, 0x688fe5b8 },
+            { 0x4a4732c0, 0x6c90d648, 0xca563299, 0xd52143fd, 0x915dc6e1, 0xb3be28c3, 0x7327191b, 0x6739687e },
+        },
+    },
+    {
+        {
+            { 0xc80c1ac0, 0xa66dcc9d, 0x1b38a436, 0x97a05cf4, 0x95dbd7c6, 0xa7ebf3be, 0x8d7e7dab, 0x7da0b8f6 },
+            { 0x385675a6, 0xef782014, 0xaafda9e8, 0xa2649f30, 0x5cdfa8cb, 0x4cd1eb50, 0x1d4dc0b3, 0x46115aba },
+            { 0xc3b5da76, 0xd40f1953, 0x21119e9b, 0x1dac6f73, 0xfeb25960, 0x03cc6021, 0x83674b4b, 0x5a5f887e },
+        },
+        {
+            { 0xa0a643b9, 0x9e9628d3, 0xe6c32064, 0xb5c3cb00, 0x7c2dec32, 0x9b530289, 0xd5d1c70c, 0x43e37ae2 },
+            { 0x70a13d11, 0x8f6301cf, 0x350dd0c4, 0xcfceb815, 0xa4bca47e, 0xf70297d4, 0xe44d1434, 0x3669b656 },
+            { 0xeda6e133, 0x387e3f06, 0x99a13ac0, 0x67301d51, 0x36263811, 0xbd5ad8f8, 0x4fd5e9be, 0x6a21e6cd },
+        },
+        {
+            { 0x6699b2e3, 0xef412912, 0x708d1301, 0x71d30847, 0x1182b0bd, 0x325432d0, 0x001e8b36, 0x45371b07 },
+            { 0x3046e65f, 0xf1c6170a, 0x00d23524, 0x58712a2a, 0x8c82b755, 0x69dbbd3c, 0xa195ff57, 0x586bf9f1 },
+            { 0x5ef8790b, 0xa6db088d, 0x610937e5, 0x5278f0dc, 0x61a16eb8, 0xac0349d2, 0x90e52179, 0x0eafb037 },
+        },
+        {
+            { 0x0f75ae1d, 0x5140805e, 0x2662cc30, 0xec02fbe3, 0xea92396d, 0x2cebdf1e, 0xc5435bb3, 0x44ae3344 },
+            { 0x3748042f, 0x960555c1, 0x820baa11, 0x219a41e6, 0x73486d0c, 0x1c81f738, 0x5a02c661, 0x309acc67 },
+            { 0xbba543ee, 0x9cf289b9, 0x5ac97142, 0xf3760e9d, 0x4f9360aa, 0x1d82e5c6, 0x7f94678f, 0x62d5221b },
+        },
+        {
+            { 0x3af77a3c, 0x7585d426, 0xfee9144d, 0xdfae7b11, 0x59f7193d, 0xa5067080, 0x83922037, 0x14f29a53 },
+            { 0x18d0936d, 0x524c299c, 0x8a0c1a0c, 0xc86bb56c, 0xdb4a8631, 0xa375052e, 0xbc754562, 0x5c0efde4 },
+            { 0x25b2d7f5, 0xdf717edc, 0x99b53040, 0x21f970db, 0xc3ed4c62, 0xda9234b7, 0x7bee093e, 0x5e72365c },
+        },
+        {
+            { 0x2f08b33e, 0x7d933906, 0xdf9f32be, 0x5b9659e5, 0x1f9ebdfd, 0xacff3dad, 0xcb7349b7, 0x70b20555 },
+            { 0x4571217f, 0x575bfc07, 0x0694d95b, 0x3779675d, 0xf4191e33, 0x9a0a37bb, 0x47b4eabc, 0x77f1104c },
+            { 0x55112c4c, 0xbe5113c5, 0x9a881fcd, 0x6688423a, 0x5e503b47, 0x44667785, 0x4a06404a, 0x0e34398f },
+        },
+        {
+            { 0x3e4b1928, 0x18930b09, 0x73f3f640, 0x7de3e10e, 0x73395d6f, 0xf43217da, 0xca379c3e, 0x6f8aded6 },
+            { 0x3ecebde8, 0xb67d22d9, 0x27822f07, 0x09b3e841, 0xb05b6d8d, 0x743fa61f, 0x8a362372, 0x5e540536 },
+            { 0xfdb7b29a, 0xe340123d, 0xa21ab291, 0x487b97e1, 0xfde6949e, 0xf9967d02, 0xc8d3de97, 0x780de72e },
+        },
+        {
+            { 0x00f42772, 0x671feaf3, 0x2a8c41aa, 0x8f72eb2a, 0x97373292, 0x29a17fd7, 0x32b587a6, 0x1defc6ad },
+            { 0x089ae7bc, 0x0ae28545, 0x1c7f4d06, 0x388ddecf, 0x0a4811b8, 0x38ac1551, 0x71928ce4, 0x0eb28bf6 },
+            { 0xef5195a7, 0xaf5bbe1a, 0x917b15ed, 0x148c1277, 0x7ae5da2e, 0x2991f7fb, 0xf8dd2867, 0x467d201b },
+        },
+    },
+    {
+        {
+            { 0x567ae7a9, 0xbc1ef4bd, 0xd64498bd, 0x3f624cb2, 0x2c1f4ec8, 0xe41064d2, 0xba384001, 0x2ef9c5a5 },
+            { 0x74ef4fad, 0x95fe919a, 0xf6a308a2, 0x3a827bec, 0x09a47b01, 0x964e01d3, 0x5ba3c797, 0x71c43c4f },
+            { 0xfa9e74cd, 0xb6fd6df6, 0xe4af267a, 0xf18278bc, 0xf1ef990e, 0x8255b3d0, 0x90c5f293, 0x5a758ca3 },
+        },
+        {
+            { 0x1d61dc94, 0x8ce0918b, 0x9a813066, 0x8ded3646, 0xafe8aad3, 0xd4e6a829, 0xf639d43f, 0x0a738027 },
+            { 0xd9462495, 0xa2b72710, 0xd57d5003, 0x3aa8c6d2, 0xa0b487ca, 0xe3d400bf, 0xb3eb72ec, 0x2dbae244 },
+            { 0x57ffe1cc, 0x980f4a2f, 0xe1839843, 0x00670d0d, 0x49fb15fd, 0x105c3f4a, 0x5126a69c, 0x2698ca63 },
+        },
+        {
+            { 0x5e3dd90e, 0x2e3d702f, 0xe4d25386, 0x9e3f0918, 0x024da96a, 0x5e773ef6, 0x4afa3332, 0x3c004b0c },
+            { 0x32b0ba78, 0xe7653188, 0x925cff8b, 0x381831f7, 0xa0291fcc, 0x08a81b91, 0x49caeb07, 0x1fb43dcc },
+            { 0x06f4b82b, 0x9aa946ac, 0xa806c4f3, 0x1ca284a5, 0xc6cd4787, 0x3ed3265f, 0xcd1fd217, 0x6b43fd01 },
+        },
+        {
+            { 0x3e760ef3, 0xb5c74258, 0xee0ab990, 0x75dc52b9, 0x072b923f, 0xbf1427c2, 0x6ff0d9f0, 0x73420b2d },
+            { 0x4697c544, 0xc7a75d4b, 0xdf0fffbf, 0x15fdf848, 0xaa46785a, 0x2868b9eb, 0x5b52f714, 0x5a68d710 },
+            { 0x9e851e06, 0xaf2cf6cb, 0xc62238c4, 0x8f593913, 0x99fbf373, 0xda8ab896, 0xea34bc9e, 0x3db5632f },
+        },
+        {
+            { 0x829825d5, 0x2e4990b1, 0x3e9a8991, 0xedeaeb87, 0x4c704af8, 0xeef03d39, 0x95df2b0e, 0x59197ea4 },
+            { 0xf75dd9d8, 0xf46eee2b, 0x396759a5, 0x0d17b1f6, 0x499e7273, 0x1bf2d131, 0x49d75f13, 0x04321adf },
+            { 0xe4e55aae, 0x04e16019, 0x7e2f92e9, 0xe77b437a, 0x6f159aa4, 0xc7ce2dc1, 0xf4d70cc0, 0x45eafdc1 },
+        },
+        {
+            { 0xcfccb1ed, 0xb60e4624, 0xbd5c0395, 0x59dbc292, 0xdc0481c9, 0x31a09d1d, 0x5d56d940, 0x3f73ceea },
+            { 0x8045d72b, 0x69840185, 0xcf2f0651, 0x4c22faa2, 0x6b222dc6, 0x941a3665, 0x0362dade, 0x5a5eebc8 },
+            { 0x0a4e8dc6, 0xb7a7bfd1, 0x44c9b339, 0xbe57007e, 0x1557aefa, 0x60c1207f, 0x266218db, 0x26058891 },
+        },
+        {
+            { 0xc676e542, 0x4c818e3c, 0x03ceccad, 0x5e422c93, 0xb4129f08, 0xec07ccca, 0xb24443b8, 0x0dedfa10 },
+            { 0x8360ff04, 0x59f704a6, 0x7661e6f4, 0xc3d93fde, 0x12873551, 0x831b2a73, 0x4e615d57, 0x54ad0c2e },
+            { 0xb82b522a, 0xee3b67d5, 0x9fa5c1eb, 0x36f16346, 0x6ec19fd3, 0xa5b4d2f2, 0xa77a9408, 0x62ecb2ba },
+        },
+        {
+            { 0xafb62874, 0x92072836, 0x79e104a5, 0x5fcd5e85, 0xc630a14a, 0x5aad01ad, 0x75663f98, 0x61913d50 },
+            { 0x61152b3d, 0xe5ed7952, 0x0eddd7d1, 0x4962357d, 0xb96b4c71, 0x7482c8d0, 0xa966d8be, 0x2e59f919 },
+            { 0x1a3231da, 0x0dc62d36, 0x94200270, 0xfa475832, 0x3f9594ce, 0x02d80151, 0x31c05d5c, 0x3ddbc2a1 },
+        },
+    },
+    {
+        {
+            { 0x2796bb14, 0xf3aa57a2, 0x9b07da21, 0x883abab7, 0x31a0391c, 0xe54be218, 0xd83205f9, 0x5ee7fb38 },
+            { 0xce5ec54b, 0x9adc0ff9, 0x8c2f130d, 0x039c2a6b, 0xf0f89515, 0x028007c7, 0xac04b36b, 0x78968314 },
+            { 0x41446a8e, 0x538dfdcb, 0x434937f9, 0xa5acfda9, 0x263c8c78, 0x46af908d, 0x9bca0d09, 0x61d0633c },
+        },
+        {
+            { 0xf8fc73df, 0xada328bc, 0xa6f037fc, 0xee84695d, 0x38c2a909, 0x637fb4db, 0xf8067bdc, 0x5b23ac2d },
+            { 0xffdb2566, 0x63744935, 0x780b68bb, 0xc5bd6b89, 0x553eec03, 0x6f1b3280, 0x47aed7f5, 0x6e965fd8 },
+            { 0xee80527b, 0x9ad2b953, 0xfade6d8d, 0xe88f19aa, 0x150e82cf, 0x0e711704, 0xdd95dedc, 0x79b9bbb9 },
+        },
+        {
+            { 0x8e9f7374, 0xd1997dae, 0xcfbb0816, 0xa032a2f8, 0x6d445f0a, 0xcd6cba12, 0x0accb834, 0x1ba81146 },
+            { 0x6a3126c2, 0xebb35540, 0x68c8c393, 0xd26383a8, 0xe5b97a82, 0x6c0c6429, 0xc9fd2147, 0x5065f158 },
+            { 0x0c429954, 0x708169fb, 0xd76ecf67, 0xe14600ac, 0x70e645ba, 0x2eaab98a, 0x58a4faf2, 0x3981f39e },
+        },
+        {
+            { 0x6de66fde, 0xc845dfa5, 0x2c40483a, 0xe152a500, 0xc7b4f632, 0xe9d2e163, 0xdcbc1b65, 0x30f4452e },
+            { 0x59230a93, 0x18fb8a75, 0x60e6f45d, 0x1d168f69, 0x14a93cb5, 0x3a85a945, 0x05acd0fd, 0x38dc0837 },
+            { 0xc5759740, 0x856d2782, 0xf99cbecc, 0xfa134569, 0xc0ea4e71, 0x8844fc73, 0x593f2469, 0x632d9a1a },
+        },
+        {
+            { 0xed0c84a7, 0xbf09fd11, 0x0d9f693a, 0x63f07181, 0x57cf8779, 0x21908c2d, 0x8af64ba2, 0x3a5a7df2 },
+            { 0xb807cba6, 0xf6bb6b15, 0xbc54f0d7, 0x1823c7df, 0x6e29670b, 0xbb1d9703, 0x47ed4a57, 0x0b24f488 },
+            { 0x511beac7, 0xdcdad4be, 0xed26ccf2, 0xa4538075, 0x005f9a65, 0xe19cff9f, 0x75481f63, 0x34fcf744 },
+        },
+        {
+            { 0x78cfaa98, 0xa5bb1dab, 0x190b72f2, 0x5ceda267, 0x0a92608e, 0x9309c911, 0x2fb374b0, 0x0119a304 },
+            { 0x789767ca, 0xc197e04c, 0x38d9467d, 0xb8714dcb, 0x83f95fa8, 0x55de8882, 0x4dfa63f7, 0x3d3bdc16 },
+            { 0xe8c2177d, 0x67a2d89c, 0x6895d0c1, 0x669da5f6, 0xb282a2b0, 0xf56598e5, 0xede20a73, 0x56c088f1 },
+        },
+        {
+            { 0x24f38f02, 0x581b5fac, 0xbae30cbd, 0xa90be9fe, 0x8acf92f0, 0x9a216902, 0x8359038f, 0x038b7ea4 },
+            { 0x10a86e17, 0x336d3d11, 0x0b75b2fa, 0xd7f38832, 0x25072988, 0xf9153376, 0x99108b87, 0x09674c6b },
+            { 0x99316ff8, 0x9f4ef821, 0xeaa78d4f, 0x2f49d282, 0x5aef3174, 0x0971a5ab, 0x5969eb65, 0x6e5e3102 },
+        },
+        {
+            { 0x63066222, 0x3304fb0e, 0x87acba3f, 0xfb350689, 0x8c1061a3, 0xbd192477, 0xd1838620, 0x3058ad43 },
+            { 0x87e593fb, 0xb16c62f5, 0xca5d3e71, 0x4999edde, 0x14cc3e6d, 0xb491c1e0, 0x89a8dba8, 0x08f51147 },
+            { 0xe57663d0, 0x323c0ffd, 0xa22ea610, 0x05c3df38, 0xac994f9a, 0xbdc78abd, 0xefe3dc99, 0x26549fa4 },
+        },
+    },
+    {
+        {
+            { 0xaf3f666e, 0xdb468549, 0xf14a0ea5, 0xd77fcf04, 0xa4ba0c47, 0x3df23ff7, 0x32ce3c85, 0x3a10dfe1 },
+            { 0x1e6bf9d6, 0x741d5a46, 0x7777a581, 0x2305b3fc, 0x6474d3d9, 0xd45574a2, 0x6401e0ff, 0x1926e1dc },
+            { 0xea17cea0, 0xe07f4e8a, 0x3a1fc1fd, 0x2fd51546, 0x31f2c0f1, 0x175322fd, 0x861e5d15, 0x1fa1d01d },
+        },
+        {
+            { 0xd1df94ab, 0x38dcac00, 0xd1080de9, 0x2e712bdd, 0xfdd5e262, 0x7f13e93e, 0xee9a01e5, 0x73fced18 },
+            { 0x7d599832, 0xcc805594, 0x37f15520, 0x1e4656da, 0x4e059320, 0x99f6f774, 0x6a75cf33, 0x773563bc },
+            { 0x63139cb3, 0x06b1e908, 0xc5a03ecd, 0xa493da67, 0xad638932, 0x8d77cec8, 0x1b864f44, 0x1f426b70 },
+        },
+        {
+            { 0x91a12552, 0xf17e35c8, 0x575e9c76, 0xb76b8153, 0x0d9b723e, 0xfa83406f, 0x3fa7e438, 0x0b76bb1b },
+            { 0x41911c01, 0xefc9264c, 0x17a22c25, 0xf1a3b7b8, 0xf30f1447, 0x5875da6b, 0x1d31b090, 0x4e1af527 },
+            { 0x7f92939b, 0x08b8c1f9, 0xd444ab6e, 0xbe6771cb, 0x99bb8017, 0x22e56463, 0xb772a955, 0x7b6dd61e },
+        },
+        {
+            { 0xab01d2c7, 0x5730abf9, 0x40143b18, 0x16fb76dc, 0xa0cbb281, 0x866cbe65, 0x9bff6afe, 0x53fa9b65 },
+            { 0x50f33d92, 0xb7adc1e8, 0x608cd5cf, 0x7998fa4f, 0x8dfc5bdb, 0xad962dbd, 0xaf1d2f4f, 0x703e9bce },
+            { 0x94885455, 0x6c14c8e9, 0x65aed4e5, 0x843a5d66, 0xbcd65af1, 0x181bb73e, 0xc4c61f50, 0x398d93e5 },
+        },
+        {
+            { 0xd2e7e3f2, 0xc3877c60, 0x30828bb1, 0x3b34aaa0, 0x739ef138, 0x283e26e7, 0x02c30577, 0x699c9c90 },
+            { 0x33e248f3, 0x1c4bd167, 0x15bf0a5f, 0xbd9e1287, 0xa10b0376, 0xd43f8cf0, 0xdf191b13, 0x53b09b5d },
+            { 0x5946f1cc, 0xf306a723, 0xcce5d97d, 0x921718b5, 0x81b4e975, 0x28cdd247, 0x6fcdd907, 0x51caf30c },
+        },
+        {
+            { 0x18ac54c7, 0x737af99a, 0xc51cb30f, 0x903378dc, 0x4ce10cc7, 0x2b89bc33, 0x89f8e99a, 0x12ae29c1 },
+            { 0x7674e00a, 0xa60ba742, 0xa17a7bf3, 0x630e8570, 0xcf3324cc, 0x3758563d, 0x2383fdaa, 0x5504aa29 },
+            { 0x1f0d01cf, 0xa99ec0cb, 0x3a34f7ae, 0x0dd1efcc, 0xd09c4e22, 0x55ca7521, 0x58eba5ea, 0x5fd14fe9 },
+        },
+        {
+            { 0xbf93cb8e, 0x3c42fe5e, 0x36d4565f, 0xbedfa851, 0x884220e8, 0xe0f0859e, 0x0725d128, 0x7dd73f96 },
+            { 0x2845ab2c, 0xb5dc2ddf, 0x0a7fe993, 0x069491b1, 0x4002e346, 0x4daaf3d6, 0x586474d1, 0x093ff26e },
+            { 0x68059829, 0xb10d24fe, 0xdbaf23e5, 0x75730672, 0xb457ac29, 0x1367253a, 0x86b470a4, 0x2f59bcbc },
+        },
+        {
+            { 0xb691c301, 0x7041d560, 0xadd7e71e, 0x85201b3f, 0x11335585, 0x16c2e163, 0x010828b1, 0x2aa55e3d },
+            { 0x9917135f, 0x83847d42, 0x567d03d7, 0xad1b911f, 0xbe77aad1, 0x7e7748d9, 0x2e51af4a, 0x5458b42e },
+            { 0x0c07444f, 0xed5192e6, 0x74421d10, 0x42c54e2d, 0xfdb5c864, 0x352b4c82, 0x8a768664, 0x13e9004a },
+        },
+    },
+    {
+        {
+            { 0x193b877f, 0xbb2e00c9, 0xe0dc506b, 0xece3a890, 0x36de649f, 0xecf3b7c0, 0x98de9e1a, 0x5f460408 },
+            { 0x832fcedb, 0x739d8845, 0xae6bf863, 0xfa38d6c9, 0xb74ffef7, 0x32bc0dca, 0x14bce45e, 0x73937e88 },
+            { 0x297bf48d, 0xb9037116, 0xd4f06834, 0xa9d13b22, 0x4696bdc6, 0xe1971557, 0x91d5e835, 0x2cf8a4e8 },
+        },
+        {
+            { 0x17d06ba2, 0x2cb5487e, 0x3950196b, 0x24d2381c, 0x85978a30, 0xd7659c81, 0x91d6a4f6, 0x7a6f7f28 },
+            { 0x07110f67, 0x6d93fd87, 0x7c38b549, 0xdd4c09d3, 0xc2736a86, 0x7cb16a4c, 0x58252a09, 0x2049bd6e },
+            { 0x6a9aef49, 0x7d09fd8d, 0x5b3db90b, 0xf0ee60be, 0x519ebfd4, 0x4c21b52c, 0xc545941d, 0x6011aadf },
+        },
+        {
+            { 0x02cbf890, 0x63ded0c8, 0x0dff6aaa, 0xfbd098ca, 0xb9b6ed99, 0x624d0afd, 0x79340b1e, 0x69ce18b7 },
+            { 0xcf95f83c, 0x5f67926d, 0x71289071, 0x7c7e8561, 0x998f7a5b, 0xd6a1e7f3, 0x0b62f9e0, 0x6fc5cc1b },
+            { 0xb29879cb, 0xd1ef5528, 0xd47e9092, 0xdd1aae3c, 0x189f2352, 0x127e0442, 0xe57101f1, 0x15596b3a },
+        },
+        {
+            { 0x7e5124ca, 0x09ff3116, 0xd9c745df, 0x0be4158b, 0x7ef556e5, 0x292b7d22, 0xafb6d138, 0x3aa4e241 },
+            { 0x3f9179a2, 0x462739d2, 0x97d6ddcf, 0xff831231, 0x53f2148a, 0x1307deb5, 0x7b5f4dda, 0x0d223768 },
+            { 0x2a3305f5, 0x2cc138bf, 0xa2e926c3, 0x48583f8f, 0x5549d2eb, 0x083ab1a2, 0x4687a36c, 0x32fcaa6e },
+        },
+        {
+            { 0x2787ccdf, 0x3207a473, 0xf213e3f8, 0x17e31908, 0xf60d964e, 0xd5b2ecd7, 0xc2600be9, 0x746f6336 },
+            { 0xc57d9af5, 0x7bc56e8d, 0x9df0bdf2, 0x3e0bd2ed, 0x22efe4a3, 0xaac014de, 0xfebd6a5c, 0x4627e9ce },
+            { 0xab6c971c, 0x3f4af345, 0x9943731f, 0xe288eb72, 0x0344186d, 0x33596a8a, 0x7ed66293, 0x7b491700 },
+        },
+        {
+            { 0xdd53a2dd, 0x54341b28, 0xdf42fc3f, 0xaa17905b, 0x4dd2f8f4, 0x0ff592d9, 0xe08cd37d, 0x1d03620f },
+            { 0xab84b064, 0x2d85fb5c, 0x89f3bc14, 0x497810d2, 0x7b15ce0c, 0x476adc44, 0xf844fd7b, 0x122ba376 },
+            { 0xa2b4e554, 0xc20232cd, 0x115d187f, 0x9ed0fd42, 0x7dd479d9, 0x2eabb4be, 0x2b68ec4c, 0x02c70bf5 },
+        },
+        {
+            { 0x458d72e1, 0xace532bf, 0x7cb73cb5, 0x5be768e0, 0xee8bbde7, 0x56cf7d94, 0xfeb43a03, 0x6b0697e3 },
+            { 0x5d0b2fbb, 0xa287ec4b, 0x074882ca, 0x415c5790, 0xc1d0815c, 0xe044a61e, 0x409ef5e0, 0x26334f0a },
+            { 0xdf62a3c0, 0xb6c8f04a, 0x076da45d, 0x3ef000ef, 0x49f0d2a9, 0x9c9cb958, 0x441b2fae, 0x1cc37f43 },
+        },
+        {
+            { 0xc9ceaeb9, 0xd76656f1, 0x18e5656a, 0x1c5b15f8, 0x844c2334, 0x26e72832, 0x2f196838, 0x3a346f77 },
+            { 0x5cc7324f, 0x508f565a, 0xe506a922, 0xd061c4c0, 0x5c45ac19, 0xfb18abdb, 0x0380314a, 0x6c6809c1 },
+            { 0xe2da6ac8, 0xd2d55112, 0xb1e851ed, 0xe9bd0331, 0x8ec67262, 0x960746dd, 0x6ef7c5d0, 0x05911b9f },
+        },
+    },
+    {
+        {
+            { 0x512eeaef, 0x5349acf3, 0x1cc1cb49, 0x20c141d3, 0xa99a688d, 0x24180c07, 0xc64b2d17, 0x555ef9d1 },
+            { 0xf5df0ebb, 0xc1339983, 0x512c4cac, 0xc0f3758f, 0x0bb398e1, 0x2cf1130a, 0xaa270c62, 0x6b3cecf9 },
+            { 0x3b73bd08, 0x36a770ba, 0xa3afbf0c, 0x624aef08, 0xb40946f2, 0x5737ff98, 0x3381749d, 0x675f4de1 },
+        },
+        {
+            { 0x3bdab31d, 0xa12ff6d9, 0x9d652dfe, 0x0725d80f, 0x9abe9487, 0x019c4ff3, 0x82cd3c43, 0x60f450b8 },
+            { 0x6b1782fc, 0x0e2c5203, 0x6cad83b4, 0x64816c81, 0x6964073e, 0xd0dcbdd9, 0x0164c520, 0x13d99df7 },
+            { 0x21e5c0ca, 0x014b5ec3, 0xd719bfa2, 0x4fcb69c9, 0x750023a0, 0x4e5f1c18, 0x55edac80, 0x1c06de9e },
+        },
+        {
+            { 0xff6d69aa, 0xffd52b40, 0xdc4049bb, 0x34530b18, 0xa34d9897, 0x5e4a5c2f, 0x7d32ba2d, 0x78096f8e },
+            { 0xa33ec4e2, 0x990f7ad6, 0xbe2ee08e, 0x6608f938, 0x63284515, 0x9ca143c5, 0xec2db60d, 0x4cf38a1f },
+            { 0x0dfa5ce7, 0xa0aaaa65, 0x48b5478c, 0xf9c49e2a, 0x7003725b, 0x4f09cc7d, 0x26091abe, 0x373cad3a },
+        },
+        {
+            { 0x89ddbbad, 0xf1bea8fb, 0x61aeaecb, 0x3bcb2cbc, 0x1f9b8d9d, 0x8f58a7bb, 0x5112a686, 0x21547eda },
+            { 0x82c9f57c, 0xb294634d, 0x24934536, 0x1fcbfde1, 0x418cdb5a, 0x9e9c4db3, 0x454419fc, 0x0040f3d9 },
+            { 0xfd5986d3, 0xdefde939, 0x510a380c, 0xf4272c89, 0xbb3119b9, 0xb72ba407, 0x4a254df4, 0x63550a33 },
+        },
+        {
+            { 0x72547b49, 0x9bba5845, 0xe2c408e0, 0xf305c6fa, 0xc734f18d, 0x60e8fa69, 0xaa7d767a, 0x39a92baf },
+            { 0xb569cf37, 0x6507d6ed, 0x0ca52ee1, 0x178429b0, 0xeb6bd65d, 0xea7c0090, 0xdaf78f51, 0x3eea62c7 },
+            { 0xe693274e, 0x9d24c713, 0x68dbd375, 0x5f638577, 0xeb8ab39a, 0x70525560, 0x65c9c4cd, 0x68436a06 },
+        },
+        {
+            { 0xe820107c, 0x1e56d317, 0x840ae965, 0xc5266844, 0x320ffc7a, 0xc1e0a1c6, 0x91611472, 0x5373669c },
+            { 0x202f3f27, 0xbc0235e8, 0x64f975b0, 0xc75c00e2, 0xa38c2416, 0x91a4e9d5, 0x8ab789f9, 0x17b6e7f6 },
+            { 0x9a0e5257, 0x5d2814ab, 0xc9cab3fc, 0x908f2084, 0x5b2d1eca, 0xafcaf588, 0x78f87d11, 0x1cb4b5a6 },
+        },
+        {
+            { 0xa2a007e7, 0x6b74aa62, 0xf071c7b1, 0xf311e0b0, 0x000be223, 0x5707e438, 0x82ef6eac, 0x2dc0fd2d },
+            { 0x394afc6c, 0xb664c06b, 0x98da5fb1, 0x0c88de24, 0x4bcad834, 0x4f8d0316, 0xde7434a2, 0x330bca78 },
+            { 0x1119744e, 0x982eff84, 0x2b074724, 0xf9695e96, 0xbfc953fb, 0xc58ac14f, 0x369f1cf5, 0x3c31be1b },
+        },
+        {
+            { 0xf9cb4272, 0xc168bc93, 0xc7cedb98, 0xaeb8711f, 0x34ac8d7a, 0x7f0e52aa, 0x7e7d55bb, 0x41cec109 },
+            { 0x08948aee, 0xb0f4864d, 0x91ba1c6f, 0x07dc19ee, 0xa6aca158, 0x7975cdae, 0x4262d4bb, 0x330b6113 },
+            { 0xa26d808a, 0xf79619d7, 0x1d9e156d, 0xbb1fd49e, 0xdba1df27, 0x73d7c36c, 0x1f28777d, 0x26b44cd9 },
+        },
+    },
+    {
+        {
+            { 0x62730383, 0xe1b7f293, 0xebca8a2c, 0x4b5279ff, 0xbfd41314, 0xdafc778a, 0x9c72610f, 0x7deb1014 },
+            { 0x8f387475, 0x51f04847, 0x9cbecb3c, 0xb25dbcf4, 0xd99f2055, 0x9aab1244, 0x1c10a5d6, 0x2c709e6c },
+            { 0x8766ee7a, 0xcb62af6a, 0x5553cd0e, 0x66cbec04, 0x0f0be4b5, 0x58800138, 0xf62ce2ea, 0x08e68e9f },
+        },
+        {
+            { 0x0ab8f2f9, 0x2f2d09d5, 0xc55923df, 0xacb9218d, 0x73766cb9, 0x4a8f3426, 0x38f719f5, 0x4cb13bd7 },
+            { 0x4bc130ad, 0x34ad500a, 0x3d0bd49c, 0x8d38db49, 0x500a89be, 0xa25c3d98, 0xeeba3b09, 0x2f1f3f87 },
+            { 0xe515b64a, 0xf7848c75, 0xdb4a9038, 0xa59501ba, 0x3f751b50, 0xc20d313f, 0xc0ae2ee8, 0x19a1e353 },
+        },
+        {
+            { 0xd596bdbd, 0xb42172cd, 0x98eefc40, 0x93e04543, 0xb44109b5, 0x9fb15347, 0x0266ae34, 0x736bd399 },
+            { 0xbafa05c3, 0x7d1c7560, 0xc6e55e61, 0xb3e1a0a0, 0xc0d66473, 0xe3529718, 0xc20c3486, 0x41546b11 },
+            { 0x9334b3b4, 0x85532d50, 0x60816573, 0x46fd114b, 0x425c8375, 0xcc5f5f30, 0xb87fab5c, 0x412295a2 },
+        },
+        {
+            { 0xe293eac6, 0x2e655261, 0x2133acdb, 0x845a9203, 0x7900996b, 0x460975cb, 0x195add80, 0x0760bb8d },
+            { 0xf57ed6e9, 0x19c99b88, 0x6df8c825, 0x5393cb26, 0xb30ad273, 0x5cee3213, 0xb52d2e34, 0x14e153eb },
+            { 0xcde6818a, 0x413e1a17, 0xed69a084, 0x57156da9, 0x46caccb1, 0x2cbf268f, 0xc33ac5f2, 0x6b34be9b },
+        },
+        {
+            { 0x6571f2d3, 0x11fc6965, 0x530e737a, 0xc6c9e845, 0xd4fe5035, 0xe33ae7a2, 0x2e6dd30b, 0x01b9c7b6 },
+            { 0x3a78c0b2, 0xf3df2f64, 0xf22e027c, 0x4c3e971e, 0x49c1b5a3, 0xec7d1c5e, 0x0922dd2d, 0x2012c18f },
+            { 0x5ac89d29, 0x880b55e5, 0x45a0a763, 0x1483241f, 0xc2e76c1f, 0x3d36efdf, 0x4e4bade8, 0x08af5b78 },
+        },
+        {
+            { 0x89cc2c4b, 0xe27314d2, 0xa287178d, 0x4be4bd11, 0xfa3364ce, 0x18d528d6, 0xafd9826e, 0x6423c1d5 },
+            { 0x881f2533, 0x283499dc, 0x779323b6, 0x9d0525da, 0x673441f4, 0x897addfb, 0x163a168d, 0x32b79d71 },
+            { 0xedfcb36a, 0xcc85f8d9, 0x3746e5f9, 0x22bcc28f, 0xf9e5d3cd, 0xe49de338, 0xc13e2dcc, 0x480a5efb },
+        },
+        {
+            { 0x42ce221f, 0xb6614ce4, 0x4c053928, 0x6e199dcc, 0xdc1cbe03, 0x663fb4a4, 0x691c8e06, 0x24b31d47 },
+            { 0x01622071, 0x0b51e70b, 0x8b1dafc5, 0x06b505cf, 0xef5aabcd, 0x2c6bb061, 0x0cb7bf31, 0x47aa2760 },
+            { 0xc015f8c3, 0x2a541eed, 0x7c693f7c, 0x11a4fe7e, 0x4ea278d6, 0xf0af6613, 0x14dda094, 0x545b585d },
+        },
+        {
+            { 0xe3b321e1, 0x6204e4d0, 0x28ff1e95, 0x3baa637a, 0x5b99bd9e, 0x0b0ccffd, 0x64c8d071, 0x4d22dc3e },
+            { 0xa0d43a0f, 0x67bf275e, 0x089beebe, 0xade68e34, 0xd479e72e, 0x4289134c, 0x32ba5454, 0x0f62f9c3 },
+            { 0xd63b5f39, 0xfcb46589, 0x57cbcf61, 0x5cae6a3f, 0x953afa05, 0xfebac2d2, 0x36371436, 0x1c0fa01a },
+        },
+    },
+    {
+        {
+            { 0x8c936a50, 0x69082b0e, 0xc1dac5b6, 0xf9c9a035, 0xc4dfb634, 0x6fb73e54, 0x1d2bc140, 0x4005419b },
+            { 0x22943dff, 0xd2c604b6, 0x44cfb3a0, 0xbc8cbece, 0x97808678, 0x5d254ff3, 0x3b1ca6bf, 0x0fa3614f },
+            { 0xb9be82f0, 0xa003febd, 0x3a44ac90, 0x2089c1af, 0x1954fa8e, 0xf8499f91, 0xef40ab42, 0x1fba218a },
+        },
+        {
+            { 0x3e7b0194, 0x4f3e5704, 0x08daaf7f, 0xa81d3eee, 0x99dcdef1, 0xc839c6ab, 0xff7761d5, 0x6c535d13 },
+            { 0xfac8f53e, 0xab549448, 0x7ba63741, 0x81f6e89a, 0x6c2b5e01, 0x74fd6c7d, 0xa8c86e42, 0x392e3aca },
+            { 0x3e8a35af, 0x4cbd34e9, 0x5887e816, 0x2e078144, 0xf29ab0ab, 0x19319c76, 0xd50ac13b, 0x25e17fe4 },
+        },
+        {
+            { 0x76f121a7, 0x915f7ff5, 0x2fcd87e3, 0xc34a3227, 0x4d1be526, 0xccba2fde, 0x8969899b, 0x6bba828f },
+            { 0x1e04f676, 0x0a289bd7, 0xd6420f95, 0x208e1c52, 0x34691fab, 0x5186d8b0, 0x2a9fb351, 0x25575144 },
+            { 0x90fe3901, 0xe2d1bc66, 0xa0997ad5, 0x4cb54a18, 0xaf8460d4, 0x971d6914, 0x7f6b7be4, 0x559d504f },
+        },
+        {
+            { 0xf6d266fd, 0x9c4891e7, 0x0307781b, 0x0744a19b, 0x6061e23b, 0x88388f1d, 0x354bd50e, 0x123ea6a3 },
+            { 0xb3eb54d5, 0xa7738378, 0xa5553c7c, 0x1d69d366, 0xf92800ba, 0x0a26cf62, 0x807e3217, 0x01ab12d5 },
+            { 0x41e32d96, 0x118d1890, 0xd8315848, 0xb9ede3c2, 0xd83245d9, 0x1eab4271, 0xc918a154, 0x4a3961e2 },
+        },
+        {
+            { 0xf3233f1e, 0x0327d644, 0x34fcf016, 0x499a260e, 0xf2dab979, 0x83b5a716, 0x9bd4111f, 0x68aceead },
+            { 0xf8e6bba0, 0x71dc3be0, 0x7effe30a, 0xd6cef834, 0xe13a476a, 0xa992425f, 0xfb1db763, 0x2cd6bce3 },
+            { 0xf3d7c210, 0x38b4c90e, 0xb7ad040c, 0x308e6e24, 0xb7e73e23, 0x3860d9f1, 0xb508f597, 0x595760d5 },
+        },
+        {
+            { 0xfd022790, 0x882acbeb, 0xc4115760, 0x89af3305, 0x7d3473f4, 0x65f492e3, 0x54515a2b, 0x2cb2c5df },
+            { 0x04aa6397, 0x6129bfe1, 0xa4a7fccb, 0x8f960008, 0x7d909458, 0x3f8bc089, 0xdcb291a9, 0x709fa43e },
+            { 0x63fd2aca, 0xeb0a5d8c, 0x2e694eff, 0xd22bc166, 0xf8cbb03a, 0x2723f36e, 0xf0c8131f, 0x70f029ec },
+        },
+        {
+            { 0x5e10b0b9, 0x2a6aafaa, 0xef041aa9, 0x78f0a370, 0xaa3ad61f, 0x773efb77, 0xa74bd9e1, 0x44eca5a2 },
+            { 0x2eed3e33, 0x461307b3, 0xa45581e7, 0xae042f33, 0x195f0366, 0xc94449d3, 0x6c314858, 0x0b7d5d8a },
+            { 0x7b95d543, 0x25d44832, 0xa3340f1d, 0x70d38300, 0x60e1c52b, 0xde1c531c, 0x2c7de9e4, 0x27222451 },
+        },
+        {
+            { 0x42a975fc, 0xbf7bbb8a, 0x96ada358, 0x8c5c3977, 0xcdedaa48, 0xe27fc76f, 0xf6bc20a6, 0x19735fd7 },
+            { 0x49c5342e, 0x1abc92af, 0xb2e6fad0, 0xffeed811, 0xfcc84e29, 0xefa28c8d, 0xa44cc543, 0x11b5df18 },
+            { 0x42c84266, 0xe3ab90d0, 0x7f19547e, 0xeb848e0f, 0x65a497b9, 0x2503a1d0, 0x91df895f, 0x0fef9111 },
+        },
+    },
+};
@@ -0,0 +1,83 @@
+/*
+Cost per signature of ed25519_verify_batch() at batch sizes 1, 4, 16 and 64, vs. ed25519_verify(). Also the cost of
+a batch holding one bad signature (the batch, then each signature on its own).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#define ED25519_NO_SEED 1
+#include "ed_25519.h"
+
+#define N 256
+#define MSG_LEN 100
+
+static unsigned char pubs[N][32], sigs[N][64], msgs[N][MSG_LEN];
+static const unsigned char *sig_ptrs[N], *msg_ptrs[N], *pub_ptrs[N];
+static size_t msg_lens[N];
+static int valid[N];
+static ed25519_batch_entry work[64];
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* best of 5, us per signature, over all N signatures in batches of n */
+static double timeBatches(int n, const unsigned char *random, int *num_valid) {
+    double best = 1e9;
+    for (int rep = 0; rep < 5; rep++) {
+        double t0 = now();
+        *num_valid = 0;
+        for (int off = 0; off + n <= N; off += n) {
+            *num_valid += ed25519_verify_batch(&sig_ptrs[off], &msg_ptrs[off], &msg_lens[off], &pub_ptrs[off], n, random, work, valid);
+        }
+        double t = (now() - t0) / (N / n * n) * 1e6;
+        if (t < best) best = t;
+    }
+    return best;
+}
+
+int main(void) {
+    unsigned char random[16];
+    int num_valid, bad = 0;
+
+    for (int k = 0; k < N; k++) {
+        unsigned char seed[32], prv[64];
+        for (int i = 0; i < 32; i++) seed[i] = rand();
+        for (int i = 0; i < MSG_LEN; i++) msgs[k][i] = rand();
+        ed25519_create_keypair(pubs[k], prv, seed);
+        ed25519_sign(sigs[k], msgs[k], MSG_LEN, pubs[k], prv);
+        sig_ptrs[k] = sigs[k];
+        msg_ptrs[k] = msgs[k];
+        pub_ptrs[k] = pubs[k];
+        msg_lens[k] = MSG_LEN;
+    }
+    for (int i = 0; i < 16; i++) random[i] = rand();
+
+    double single = 1e9;
+    for (int rep = 0; rep < 5; rep++) {
+        double t0 = now();
+        for (int k = 0; k < N; k++) bad += !ed25519_verify(sigs[k], msgs[k], MSG_LEN, pubs[k]);
+        double t = (now() - t0) / N * 1e6;
+        if (t < single) single = t;
+    }
+    printf("ed25519_verify: %6.1f us/sig\n", single);
+
+    int sizes[] = { 1, 4, 16, 64 };
+    for (int s = 0; s < 4; s++) {
+        int n = sizes[s];
+        double t = timeBatches(n, random, &num_valid);
+        if (num_valid != N / n * n) bad++;
+        printf("batch of %2d:    %6.1f us/sig  (%.2fx)\n", n, t, single / t);
+    }
+
+    for (int k = 0; k < N; k += 16) sigs[k][40] ^= 1;   /* one bad signature in each batch of 16 */
+    double t = timeBatches(16, random, &num_valid);
+    if (num_valid != N - N / 16) bad++;
+    printf("batch of 16, one bad: %6.1f us/sig  (%.2fx)\n", t, single / t);
+
+    if (bad) printf("FAIL: wrong results\n");
+    return bad != 0;
+}
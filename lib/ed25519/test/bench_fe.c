@@ -0,0 +1,53 @@
+/*
+Cost of the field ops, and of sign/verify/key exchange, for the backend it's built with (bench_fe: ref10 fe.c,
+bench_fe32: fe_32.c). Host timings favour ref10's 64-bit products, so they don't predict the 32-bit targets.
+*/
+#include <stdio.h>
+#include <time.h>
+#define ED25519_NO_SEED 1
+#include "ed_25519.h"
+#include "fe.h"
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* best of 7, us per op */
+#define BENCH(label, n, stmt) do { \
+    double best = 1e9; \
+    for (int rep = 0; rep < 7; rep++) { \
+        double t0 = now(); \
+        for (int i = 0; i < n; i++) { stmt; } \
+        double t = (now() - t0) / n; \
+        if (t < best) best = t; \
+    } \
+    printf("  %-14s %9.3f us\n", label, best * 1e6); \
+} while (0)
+
+int main(void) {
+    unsigned char seed[32] = { 1, 2, 3 }, pub[32], prv[64], pub2[32], prv2[64], sig[64], msg[100] = { 0 }, shared[32];
+    volatile int sink = 0;
+    fe f, g;
+
+    ed25519_create_keypair(pub, prv, seed);
+    seed[0] = 9;
+    ed25519_create_keypair(pub2, prv2, seed);
+    ed25519_sign(sig, msg, 100, pub, prv);
+    fe_frombytes(f, pub);
+    fe_frombytes(g, pub2);
+
+#ifdef ED25519_FE32
+    printf("ED25519_FE32 (radix 2^32):\n");
+#else
+    printf("ref10 (radix 2^25.5):\n");
+#endif
+    BENCH("fe_mul", 200000, fe_mul(f, f, g));
+    BENCH("fe_sq", 200000, fe_sq(f, f));
+    BENCH("fe_invert", 2000, fe_invert(g, g));
+    BENCH("sign", 2000, ed25519_sign(sig, msg, 100, pub, prv));
+    BENCH("verify", 2000, sink += ed25519_verify(sig, msg, 100, pub));
+    BENCH("key_exchange", 2000, ed25519_key_exchange(shared, pub2, prv));
+    return sink != 7 * 2000;
+}
@@ -0,0 +1,80 @@
+/*
+Cost of ed25519_verify(), and the peak stack used by verify, sign and key exchange.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#define ED25519_NO_SEED 1
+#include "ed_25519.h"
+
+#define NUM_KEYS  500
+#define MSG_LEN   100
+
+static unsigned char pubs[NUM_KEYS][32], prvs[NUM_KEYS][64], sigs[NUM_KEYS][64], msgs[NUM_KEYS][MSG_LEN];
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* best of 7, us per key */
+#define TIME_US(result, stmt) do { \
+    result = 1e9; \
+    for (int rep = 0; rep < 7; rep++) { \
+        double t0 = now(); \
+        for (int k = 0; k < NUM_KEYS; k++) { stmt; } \
+        double t = (now() - t0) / NUM_KEYS * 1e6; \
+        if (t < result) result = t; \
+    } \
+} while (0)
+
+static int which_op;
+static unsigned char shared[32];
+
+static void *runOp(void *arg) {
+    if (which_op == 0) ed25519_verify(sigs[0], msgs[0], MSG_LEN, pubs[0]);
+    if (which_op == 1) ed25519_sign(sigs[0], msgs[0], MSG_LEN, pubs[0], prvs[0]);
+    if (which_op == 2) ed25519_key_exchange(shared, pubs[1], prvs[0]);
+    return arg;
+}
+
+/* runs the op on a thread with a painted stack, returns bytes touched (including the thread's own overhead) */
+static int stackUsed(int op) {
+    static unsigned char stack[65536] __attribute__((aligned(64)));
+    pthread_attr_t attr;
+    pthread_t t;
+    int i = 0;
+
+    memset(stack, 0xA5, sizeof(stack));
+    which_op = op;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, stack, sizeof(stack));
+    pthread_create(&t, &attr, runOp, NULL);
+    pthread_join(t, NULL);
+    while (i < (int) sizeof(stack) && stack[i] == 0xA5) i++;
+    return (int) sizeof(stack) - i;
+}
+
+int main(void) {
+    volatile int sink = 0;
+    double verify_us;
+
+    for (int k = 0; k < NUM_KEYS; k++) {
+        unsigned char seed[32];
+        for (int i = 0; i < 32; i++) seed[i] = rand();
+        for (int i = 0; i < MSG_LEN; i++) msgs[k][i] = rand();
+        ed25519_create_keypair(pubs[k], prvs[k], seed);
+        ed25519_sign(sigs[k], msgs[k], MSG_LEN, pubs[k], prvs[k]);
+    }
+
+    TIME_US(verify_us, sink += ed25519_verify(sigs[k], msgs[k], MSG_LEN, pubs[k]));
+    printf("ed25519_verify  %6.1f us\n", verify_us);
+    if (sink != 7 * NUM_KEYS) printf("FAIL: a good signature was rejected\n");
+
+    int base = stackUsed(-1);
+    printf("peak stack: verify %d, sign %d, key_exchange %d bytes\n", stackUsed(0) - base, stackUsed(1) - base, stackUsed(2) - base);
+    return sink != 7 * NUM_KEYS;
+}
@@ -0,0 +1,110 @@
+/*
+Prints the results of every fe_ op, and of the public API, on a fixed pseudo-random sequence of inputs. Built once for
+each field backend, the two outputs must be identical (see 'make compare').
+Field ops get random and edge inputs (>= p, = p, zero, all-ones), and unreduced add/sub results into fe_mul, as ge.c
+does. Then keypairs, signatures, key exchange, add_scalar, and single, batch and random-key verifies.
+*/
+#include <stdio.h>
+#include <string.h>
+#define ED25519_NO_SEED 1
+#include "ed_25519.h"
+#include "fe.h"
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static void randomBytes(unsigned char *b, int n) {
+    for (int i = 0; i < n; i++) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 7;
+        rng_state ^= rng_state << 17;
+        b[i] = rng_state & 0xFF;
+    }
+}
+
+static void printHex(const unsigned char *b, int n) {
+    for (int i = 0; i < n; i++) printf("%02x", b[i]);
+    printf("\n");
+}
+
+static void printFe(const fe f) {
+    unsigned char s[32];
+    fe_tobytes(s, f);
+    printHex(s, 32);
+}
+
+static void compareFieldOps(void) {
+    for (int it = 0; it < 3000; it++) {
+        unsigned char a[32], b[32];
+        fe f, g, h, k;
+        randomBytes(a, 32);
+        randomBytes(b, 32);
+        if (it % 10 == 1) { memset(a, 0xFF, 32); a[31] = 0x7F; }               /* >= p */
+        if (it % 10 == 2) { memset(a, 0xFF, 32); a[0] = 0xEC; a[31] = 0x7F; }  /* = p */
+        if (it % 10 == 3) { memset(b, 0, 32); }
+        if (it % 10 == 4) { memset(a, 0xFF, 32); memset(b, 0xFF, 32); }
+        fe_frombytes(f, a);
+        fe_frombytes(g, b);
+
+        fe_add(h, f, g); printFe(h);
+        fe_sub(h, f, g); printFe(h);
+        fe_sub(h, g, f); printFe(h);
+        fe_neg(h, f); printFe(h);
+        fe_mul(h, f, g); printFe(h);
+        fe_sq(h, f); printFe(h);
+        fe_sq2(h, f); printFe(h);
+        fe_mul121666(h, f); printFe(h);
+        fe_invert(h, f); printFe(h);
+        fe_pow22523(h, g); printFe(h);
+        fe_add(h, f, g); fe_sub(k, f, g); fe_mul(h, h, k); printFe(h);
+        fe_copy(h, f); fe_copy(k, g); fe_cswap(h, k, it & 1); printFe(h); printFe(k);
+        fe_cmov(h, g, (it >> 1) & 1); printFe(h);
+        printf("%d %d\n", fe_isnegative(f), fe_isnonzero(h));
+        for (int j = 0; j < 20; j++) {   /* NOTE: keeps to ref10's input bounds, eg. no sub of an unreduced add */
+            fe_mul(h, h, f);
+            fe_sq(k, h);
+            fe_sub(k, k, g);
+            fe_add(h, h, f);
+            fe_mul(h, h, k);
+        }
+        printFe(h);
+    }
+}
+
+static void compareApi(void) {
+    static ed25519_batch_entry work[2];
+    for (int it = 0; it < 300; it++) {
+        unsigned char seed[32], pub[32], prv[64], sig[64], msg[80], pub2[32], prv2[64], shared[32], scalar[32], random[16];
+
+        randomBytes(seed, 32);
+        ed25519_create_keypair(pub, prv, seed); printHex(pub, 32); printHex(prv, 64);
+        randomBytes(seed, 32);
+        ed25519_create_keypair(pub2, prv2, seed);
+        randomBytes(msg, 80);
+        ed25519_sign(sig, msg, 80, pub, prv); printHex(sig, 64);
+        ed25519_key_exchange(shared, pub2, prv); printHex(shared, 32);
+        ed25519_key_exchange(shared, pub, prv2); printHex(shared, 32);
+        ed25519_derive_pub(pub2, prv); printHex(pub2, 32);
+        randomBytes(scalar, 32);
+        ed25519_add_scalar(pub2, prv2, scalar); printHex(pub2, 32); printHex(prv2, 64);
+
+        printf("%d\n", ed25519_verify(sig, msg, 80, pub));
+        msg[it % 80] ^= 1;
+        printf("%d\n", ed25519_verify(sig, msg, 80, pub));
+        msg[it % 80] ^= 1;
+
+        const unsigned char *sigs[2] = { sig, sig }, *msgs[2] = { msg, msg }, *pubs[2] = { pub, pub };
+        size_t msg_lens[2] = { 80, 80 };
+        int valid[2];
+        randomBytes(random, 16);
+        printf("%d\n", ed25519_verify_batch(sigs, msgs, msg_lens, pubs, 2, random, work, valid));
+
+        randomBytes(pub2, 32);   /* random, often invalid, key */
+        printf("%d\n", ed25519_verify(sig, msg, 80, pub2));
+    }
+}
+
+int main(void) {
+    compareFieldOps();
+    compareApi();
+    return 0;
+}
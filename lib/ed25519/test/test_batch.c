@@ -0,0 +1,197 @@
+/*
+ed25519_verify_batch() checks:
+- random batches of 1-20, with a tampered R, s, message or key: per-signature results match ed25519_verify()
+- signatures with a small-order component in R or A (which ed25519_verify() may reject): accepted by a batch of one,
+  and by every batch they're in, whatever the random z_i, as the check is cofactored
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define ED25519_NO_SEED 1
+#include "ed_25519.h"
+#include "sha512.h"
+#include "ge.h"
+#include "sc.h"
+
+#define N 256
+#define MSG_LEN 100
+
+static unsigned char pubs[N][32], prvs[N][64], sigs[N][64], msgs[N][MSG_LEN];
+static const unsigned char *sig_ptrs[N], *msg_ptrs[N], *pub_ptrs[N];
+static size_t msg_lens[N];
+static int valid[N];
+static ed25519_batch_entry work[64];
+
+/* small-order points: order 2, order 4, and two of order 8 */
+static const unsigned char torsion[4][32] = {
+    { 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f },
+    { 0 },
+    { 0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0, 0x45, 0xc3, 0xf4, 0x89, 0xf2, 0xef, 0x98, 0xf0,
+      0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6, 0x33, 0x39, 0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05 },
+    { 0xc7, 0x17, 0x6a, 0x70, 0x3d, 0x4d, 0xd8, 0x4f, 0xba, 0x3c, 0x0b, 0x76, 0x0d, 0x10, 0x67, 0x0f,
+      0x2a, 0x20, 0x53, 0xfa, 0x2c, 0x39, 0xcc, 0xc6, 0x4e, 0xc7, 0xfd, 0x77, 0x92, 0xac, 0x03, 0x7a },
+};
+static const int torsion_order[4] = { 2, 4, 8, 8 };
+
+static void randomBytes(unsigned char *b, int n) {
+    for (int i = 0; i < n; i++) b[i] = rand();
+}
+
+static int isIdentity(const ge_p2 *p) {
+    fe t;
+    fe_sub(t, p->Y, p->Z);
+    return !fe_isnonzero(p->X) && !fe_isnonzero(t);
+}
+
+/* order of the point, if a small one (1, 2, 4 or 8), else 0 */
+static int smallOrder(const unsigned char *s) {
+    ge_p3 P;
+    ge_p2 r;
+    ge_p1p1 t;
+    if (ge_frombytes_negate_vartime(&P, s) != 0) return -1;
+    ge_p3_to_p2(&r, &P);
+    for (int order = 1; order <= 8; order *= 2) {
+        if (isIdentity(&r)) return order;
+        ge_p2_dbl(&t, &r);
+        ge_p1p1_to_p2(&r, &t);
+    }
+    return 0;
+}
+
+/* out = encoding of P + torsion point T */
+static void addTorsion(unsigned char *out, const ge_p3 *P, const unsigned char *T) {
+    ge_p3 negT, sum;
+    ge_cached c;
+    ge_p1p1 t;
+    ge_frombytes_negate_vartime(&negT, T);   /* -T is small order too */
+    ge_p3_to_cached(&c, &negT);
+    ge_add(&t, P, &c);
+    ge_p1p1_to_p3(&sum, &t);
+    ge_p3_tobytes(out, &sum);
+}
+
+/* signs as ed25519_sign(), but with T added to R (torsioned_r) or to the public key */
+static void signTorsioned(unsigned char *sig, unsigned char *pub, const unsigned char *msg, const unsigned char *prv, const unsigned char *T, int torsioned_r) {
+    sha512_context hash;
+    unsigned char r[64], h[64];
+    ge_p3 R, A;
+
+    sha512_init(&hash);
+    sha512_update(&hash, prv + 32, 32);
+    sha512_update(&hash, msg, MSG_LEN);
+    sha512_final(&hash, r);
+    sc_reduce(r);
+    ge_scalarmult_base(&R, r);
+    if (torsioned_r) {
+        addTorsion(sig, &R, T);
+    } else {
+        ge_p3_tobytes(sig, &R);
+        ge_scalarmult_base(&A, prv);
+        addTorsion(pub, &A, T);
+    }
+
+    sha512_init(&hash);
+    sha512_update(&hash, sig, 32);
+    sha512_update(&hash, pub, 32);
+    sha512_update(&hash, msg, MSG_LEN);
+    sha512_final(&hash, h);
+    sc_reduce(h);
+    sc_muladd(sig + 32, h, prv, r);
+}
+
+static int checkRandomBatches(void) {
+    int bad = 0;
+    for (int it = 0; it < 300; it++) {
+        int n = 1 + rand() % 20, off = rand() % (N - n);
+        int which = (it % 3 == 0) ? -1 : rand() % n;
+        unsigned char save_sig[64], save_msg[MSG_LEN], save_pub[32], random[16];
+
+        if (which >= 0) {
+            int k = off + which;
+            memcpy(save_sig, sigs[k], 64);
+            memcpy(save_msg, msgs[k], MSG_LEN);
+            memcpy(save_pub, pubs[k], 32);
+            switch (rand() % 4) {
+                case 0: sigs[k][rand() % 32] ^= 1 << (rand() % 8); break;
+                case 1: sigs[k][32 + rand() % 31] ^= 1 << (rand() % 8); break;
+                case 2: msgs[k][rand() % MSG_LEN] ^= 1; break;
+                default: pubs[k][rand() % 31] ^= 1; break;
+            }
+        }
+        randomBytes(random, 16);
+        int num_valid = ed25519_verify_batch(&sig_ptrs[off], &msg_ptrs[off], &msg_lens[off], &pub_ptrs[off], n, random, work, valid);
+        int expected = 0;
+        for (int i = 0; i < n; i++) {
+            int ok = ed25519_verify(sigs[off + i], msgs[off + i], MSG_LEN, pubs[off + i]);
+            if (valid[i] != ok) bad++;
+            expected += ok;
+        }
+        if (num_valid != expected) bad++;
+        if (which >= 0) {
+            memcpy(sigs[off + which], save_sig, 64);
+            memcpy(msgs[off + which], save_msg, MSG_LEN);
+            memcpy(pubs[off + which], save_pub, 32);
+        }
+    }
+    printf("random batches: %d mismatches with ed25519_verify()\n", bad);
+    return bad;
+}
+
+static int checkTorsion(void) {
+    int bad = 0;
+    for (int ti = 0; ti < 4; ti++) {
+        if (smallOrder(torsion[ti]) != torsion_order[ti]) {
+            printf("FAIL: torsion point %d isn't of order %d\n", ti, torsion_order[ti]);
+            return 1;
+        }
+        for (int torsioned_r = 0; torsioned_r <= 1; torsioned_r++) {
+            /* entry 0 is torsioned, the rest are good */
+            unsigned char save_pub[32];
+            memcpy(save_pub, pubs[0], 32);
+            signTorsioned(sigs[0], pubs[0], msgs[0], prvs[0], torsion[ti], torsioned_r);
+
+            unsigned char random[16];
+            int single = ed25519_verify(sigs[0], msgs[0], MSG_LEN, pubs[0]);
+            randomBytes(random, 16);
+            int one = ed25519_verify_batch(sig_ptrs, msg_ptrs, msg_lens, pub_ptrs, 1, random, work, valid);
+            int accepted = 0, with_bad = 0;
+            for (int t = 0; t < 200; t++) {
+                randomBytes(random, 16);
+                accepted += ed25519_verify_batch(sig_ptrs, msg_ptrs, msg_lens, pub_ptrs, 4, random, work, valid) == 4;
+            }
+            sigs[2][40] ^= 1;   /* and with a bad signature in the batch */
+            for (int t = 0; t < 20; t++) {
+                randomBytes(random, 16);
+                with_bad += ed25519_verify_batch(sig_ptrs, msg_ptrs, msg_lens, pub_ptrs, 4, random, work, valid) == 3 && valid[0] && !valid[2];
+            }
+            sigs[2][40] ^= 1;
+            printf("order %d torsion in %s: ed25519_verify %d, batch of one %d, batch of 4 accepted %d/200, with a bad sig %d/20\n",
+                torsion_order[ti], torsioned_r ? "R" : "A", single, one, accepted, with_bad);
+            if (one != 1 || accepted != 200 || with_bad != 20) bad++;
+            if (torsioned_r && single) bad++;   /* cofactorless verify must reject these */
+
+            memcpy(pubs[0], save_pub, 32);
+            ed25519_sign(sigs[0], msgs[0], MSG_LEN, pubs[0], prvs[0]);
+        }
+    }
+    return bad;
+}
+
+int main(void) {
+    srand(5);
+    for (int k = 0; k < N; k++) {
+        unsigned char seed[32];
+        randomBytes(seed, 32);
+        randomBytes(msgs[k], MSG_LEN);
+        ed25519_create_keypair(pubs[k], prvs[k], seed);
+        ed25519_sign(sigs[k], msgs[k], MSG_LEN, pubs[k], prvs[k]);
+        sig_ptrs[k] = sigs[k];
+        msg_ptrs[k] = msgs[k];
+        pub_ptrs[k] = pubs[k];
+        msg_lens[k] = MSG_LEN;
+    }
+    int bad = checkRandomBatches() + checkTorsion();
+    if (bad) printf("FAIL\n");
+    return bad != 0;
+}
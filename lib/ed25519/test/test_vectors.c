@@ -0,0 +1,56 @@
+/*
+RFC 8032 Ed25519 test vectors 1-3 (section 7.1): public key from seed, signature, and verify. Built for both field
+backends (ref10 fe.c, and fe_32.c with ED25519_FE32).
+*/
+#include <stdio.h>
+#include <string.h>
+#define ED25519_NO_SEED 1
+#include "ed_25519.h"
+
+static const char *vectors[][4] = {   /* secret key (seed), public key, message, signature */
+    { "9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60",
+      "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a",
+      "",
+      "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b" },
+    { "4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb",
+      "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c",
+      "72",
+      "92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00" },
+    { "c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7",
+      "fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025",
+      "af82",
+      "6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a" },
+};
+
+static int fromHex(unsigned char *out, const char *hex) {
+    int n = 0;
+    for (; hex[2 * n]; n++) sscanf(hex + 2 * n, "%2hhx", &out[n]);
+    return n;
+}
+
+int main(void) {
+    int bad = 0;
+    for (int t = 0; t < (int) (sizeof(vectors) / sizeof(vectors[0])); t++) {
+        unsigned char seed[32], pub[32], prv[64], sig[64], expected_pub[32], expected_sig[64], msg[8];
+        fromHex(seed, vectors[t][0]);
+        fromHex(expected_pub, vectors[t][1]);
+        int msg_len = fromHex(msg, vectors[t][2]);
+        fromHex(expected_sig, vectors[t][3]);
+
+        ed25519_create_keypair(pub, prv, seed);
+        ed25519_sign(sig, msg, msg_len, pub, prv);
+        int ok = memcmp(pub, expected_pub, 32) == 0 && memcmp(sig, expected_sig, 64) == 0 && ed25519_verify(sig, msg, msg_len, pub);
+        sig[0] ^= 1;
+        ok = ok && !ed25519_verify(sig, msg, msg_len, pub);
+        if (!ok) {
+            printf("FAIL: RFC 8032 test %d\n", t + 1);
+            bad++;
+        }
+    }
+#ifdef ED25519_FE32
+    printf("RFC 8032 vectors (ED25519_FE32): %d failed\n", bad);
+#else
+    printf("RFC 8032 vectors (ref10): %d failed\n", bad);
+#endif
+    return bad != 0;
+}
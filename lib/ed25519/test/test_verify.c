@@ -0,0 +1,46 @@
+/*
+Verify checks, meant to be run under ASan/UBSan (see Makefile): good signatures, tampered R, s, message or key,
+random (mostly invalid) keys and signatures, all-ones and small-order keys, empty and odd length messages (each in
+its own malloc'd buffer, so an over-read is caught).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define ED25519_NO_SEED 1
+#include "ed_25519.h"
+
+static void randomBytes(unsigned char *b, int n) {
+    for (int i = 0; i < n; i++) b[i] = rand();
+}
+
+int main(void) {
+    int bad = 0, accepted = 0;
+    srand(7);
+    for (int it = 0; it < 20000; it++) {
+        unsigned char seed[32], pub[32], prv[64], sig[64];
+        int len = rand() % 300;
+        unsigned char *msg = malloc(len ? len : 1);
+        randomBytes(seed, 32);
+        randomBytes(msg, len);
+        ed25519_create_keypair(pub, prv, seed);
+        ed25519_sign(sig, msg, len, pub, prv);
+
+        int mode = it % 8;
+        if (mode == 3 && len == 0) mode = 0;   /* nothing to tamper with */
+        if (mode == 1) sig[rand() % 32] ^= 1 << (rand() % 8);           /* R */
+        if (mode == 2) sig[32 + rand() % 31] ^= 1 << (rand() % 8);      /* s */
+        if (mode == 3) msg[rand() % len] ^= 1;
+        if (mode == 4) randomBytes(pub, 32);
+        if (mode == 5) randomBytes(sig, 64);
+        if (mode == 6) memset(pub, 0xFF, 32);
+        if (mode == 7) { memset(pub, 0, 32); pub[0] = 1; }              /* identity, small order */
+
+        int ok = ed25519_verify(sig, msg, len, pub);
+        if (mode == 0 && !ok) bad++;
+        if (mode >= 1 && mode <= 3 && ok) bad++;
+        accepted += ok;
+        free(msg);
+    }
+    printf("verify: %d accepted, %d mismatches\n", accepted, bad);
+    return bad != 0;
+}
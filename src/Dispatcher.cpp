@@ -11,10 +11,15 @@ namespace mesh {
 #define MAX_RX_DELAY_MILLIS        32000  // 32 seconds
 #define MIN_TX_BUDGET_RESERVE_MS   100    // min budget (ms) required before allowing next TX
 #define MIN_TX_BUDGET_AIRTIME_DIV  2      // require at least 1/N of estimated airtime as budget before TX
+#define MIN_TX_CLASS_REFILL_MS     100    // min refill (ms) to divide between traffic classes
+#define TX_CLASS_RETRY_MILLIS      500    // when all due packets are in traffic classes with no budget
 
 #ifndef NOISE_FLOOR_CALIB_INTERVAL
   #define NOISE_FLOOR_CALIB_INTERVAL   2000     // 2 seconds
 #endif
+#ifndef MAX_RECV_PER_LOOP
+  #define MAX_RECV_PER_LOOP   4     // max packets taken from radio (ie. its receive queue) per loop()
+#endif
 
 void Dispatcher::begin() {
   n_sent_flood = n_sent_direct = 0;
@@ -25,6 +30,7 @@ void Dispatcher::begin() {
   duty_cycle_window_ms = getDutyCycleWindowMs();
   float duty_cycle = 1.0f / (1.0f + getAirtimeBudgetFactor());
   tx_budget_ms = (unsigned long)(duty_cycle_window_ms * duty_cycle);
+  memset(class_budget_ms, 0, sizeof(class_budget_ms));   // filled from refills
   last_budget_update = _ms->getMillis();
 
   _radio->begin();
@@ -43,13 +49,62 @@ void Dispatcher::updateTxBudget() {
   unsigned long max_budget = (unsigned long)(getDutyCycleWindowMs() * duty_cycle);
   unsigned long refill = (unsigned long)(elapsed * duty_cycle);
   
-  if (refill > 0) {
-    tx_budget_ms += refill;
-    if (tx_budget_ms > max_budget) {
-      tx_budget_ms = max_budget;
+  uint32_t total_share = 0;
+  for (int c = 0; c < NUM_TX_CLASSES; c++) {
+    total_share += getTxClassShare(c);
+  }
+  if (refill == 0 || (total_share > 0 && refill < MIN_TX_CLASS_REFILL_MS)) return;   // (so that refill can be divided)
+
+  unsigned long shared = refill;   // not reserved, or unused by classes
+  unsigned long reserved = 0;
+  if (total_share <= 100) {
+    for (int c = 0; c < NUM_TX_CLASSES; c++) {
+      unsigned long max_class = max_budget * getTxClassShare(c) / 100;
+      unsigned long r = refill * getTxClassShare(c) / 100;
+      shared -= r;
+      class_budget_ms[c] += r;
+      if (class_budget_ms[c] > max_class) {   // class budget is full, rest goes to shared
+        shared += class_budget_ms[c] - max_class;
+        class_budget_ms[c] = max_class;
+      }
+      reserved += class_budget_ms[c];
     }
-    last_budget_update = now;
   }
+  tx_budget_ms += shared;
+  if (tx_budget_ms + reserved > max_budget) {
+    tx_budget_ms = reserved < max_budget ? max_budget - reserved : 0;
+  }
+  last_budget_update = now;
+}
+
+void Dispatcher::spendTxBudget(uint8_t tx_class, unsigned long airtime) {
+  if (airtime <= class_budget_ms[tx_class]) {
+    class_budget_ms[tx_class] -= airtime;
+    return;
+  }
+  airtime -= class_budget_ms[tx_class];   // use up class's reserved budget first, then borrow from shared
+  class_budget_ms[tx_class] = 0;
+  if (airtime > tx_budget_ms) {
+    tx_budget_ms = 0;
+  } else {
+    tx_budget_ms -= airtime;
+  }
+}
+
+unsigned long Dispatcher::getMaxClassTxBudget() const {
+  unsigned long max_class = 0;
+  for (int c = 0; c < NUM_TX_CLASSES; c++) {
+    if (class_budget_ms[c] > max_class) max_class = class_budget_ms[c];
+  }
+  return tx_budget_ms + max_class;
+}
+
+unsigned long Dispatcher::getRemainingTxBudget() const {
+  unsigned long total = tx_budget_ms;
+  for (int c = 0; c < NUM_TX_CLASSES; c++) {
+    total += class_budget_ms[c];
+  }
+  return total;
 }
 
 int Dispatcher::calcRxDelay(float score, uint32_t air_time) const {
@@ -89,16 +144,12 @@ void Dispatcher::loop() {
       //Serial.print("  airtime="); Serial.println(t);
 
       updateTxBudget();
+      spendTxBudget(outbound->_tx_class, t);
 
-      if (t > tx_budget_ms) {
-        tx_budget_ms = 0;
-      } else {
-        tx_budget_ms -= t;
-      }
-
-      if (tx_budget_ms < MIN_TX_BUDGET_RESERVE_MS) {
+      unsigned long avail = getMaxClassTxBudget();
+      if (avail < MIN_TX_BUDGET_RESERVE_MS) {
         float duty_cycle = 1.0f / (1.0f + getAirtimeBudgetFactor());
-        unsigned long needed = MIN_TX_BUDGET_RESERVE_MS - tx_budget_ms;
+        unsigned long needed = MIN_TX_BUDGET_RESERVE_MS - avail;
         next_tx_time = futureMillis((unsigned long)(needed / duty_cycle));
       } else {
         next_tx_time = _ms->getMillis();
@@ -141,13 +192,45 @@ void Dispatcher::loop() {
       processRecvPacket(pkt);
     }
   }
-  checkRecv();
+  for (int i = 0; i < MAX_RECV_PER_LOOP && checkRecv(); i++) { }   // drain radio's receive queue
   checkSend();
 }
 
+unsigned long Dispatcher::getNextDeadline() {
+  unsigned long now = _ms->getMillis();
+  if (outbound) {
+    return outbound_expiry;   // TX complete IRQ will wake us sooner
+  }
+  if (_radio->needsPolling()) return now;
+
+  unsigned long deadline = now + duty_cycle_window_ms;   // nothing scheduled, effectively 'forever'
+  if (getInterferenceThreshold() > 0) {   // otherwise, noise floor is just for stats, can be re-calibrated on next wake
+    deadline = earliestMillis(deadline, next_floor_calib_time);
+  }
+  if (getAGCResetInterval() > 0) {
+    deadline = earliestMillis(deadline, next_agc_reset_time);
+  }
+
+  uint32_t t;
+  if (_mgr->getNextInboundTime(t)) {
+    deadline = earliestMillis(deadline, t);
+  }
+  if (_mgr->getNextOutboundTime(t)) {
+    if ((long)(next_tx_time - t) > 0) t = next_tx_time;   // waiting for TX budget, or CAD retry
+    deadline = earliestMillis(deadline, t);
+  }
+  return deadline;
+}
+
+unsigned long Dispatcher::getMillisUntilNextDeadline() {
+  long d = (long)(getNextDeadline() - _ms->getMillis());
+  return d > 0 ? d : 0;
+}
+
 bool Dispatcher::tryParsePacket(Packet* pkt, const uint8_t* raw, int len) {
   int i = 0;
 
+  pkt->invalidateHash();
   pkt->header = raw[i++];
   if (pkt->getPayloadVer() > PAYLOAD_VER_1) {
     MESH_DEBUG_PRINTLN("%s Dispatcher::checkRecv(): unsupported packet version", getLogDateTime());
@@ -187,13 +270,14 @@ bool Dispatcher::tryParsePacket(Packet* pkt, const uint8_t* raw, int len) {
   return true;  // success
 }
 
-void Dispatcher::checkRecv() {
+bool Dispatcher::checkRecv() {
+  int len;
   Packet* pkt;
   float score;
   uint32_t air_time;
   {
     uint8_t raw[MAX_TRANS_UNIT+1];
-    int len = _radio->recvRaw(raw, MAX_TRANS_UNIT);
+    len = _radio->recvRaw(raw, MAX_TRANS_UNIT);
     if (len > 0) {
       logRxRaw(_radio->getLastSNR(), _radio->getLastRSSI(), raw, len);
 
@@ -255,10 +339,14 @@ void Dispatcher::checkRecv() {
       processRecvPacket(pkt);
     }
   }
+  return len > 0;
 }
 
 void Dispatcher::processRecvPacket(Packet* pkt) {
-  DispatcherAction action = onRecvPacket(pkt);
+  applyRecvAction(pkt, onRecvPacket(pkt));
+}
+
+void Dispatcher::applyRecvAction(Packet* pkt, DispatcherAction action) {
   if (action == ACTION_RELEASE) {
     _mgr->free(pkt);
   } else if (action == ACTION_MANUAL_HOLD) {
@@ -267,7 +355,16 @@ void Dispatcher::processRecvPacket(Packet* pkt) {
     uint8_t priority = (action >> 24) - 1;
     uint32_t _delay = action & 0xFFFFFF;
 
-    _mgr->queueOutbound(pkt, priority, futureMillis(_delay));
+    if (pkt->getPayloadType() == PAYLOAD_TYPE_ADVERT) {
+      pkt->_tx_class = TX_CLASS_ADVERT;
+    } else {
+      pkt->_tx_class = pkt->isRouteFlood() ? TX_CLASS_FLOOD_FWD : TX_CLASS_DIRECT_FWD;
+    }
+    uint32_t ttl = getRetransmitTTL(pkt);
+    uint32_t expires_at = ttl ? futureMillis(_delay + ttl) : 0;
+    if (ttl && expires_at == 0) expires_at = 1;   // zero is reserved for 'never'
+
+    _mgr->queueOutbound(pkt, priority, futureMillis(_delay), expires_at, calcDeadline(pkt, _delay));
   }
 }
 
@@ -277,9 +374,14 @@ void Dispatcher::checkSend() {
   updateTxBudget();
   
   uint32_t est_airtime = _radio->getEstAirtimeFor(MAX_TRANS_UNIT);
-  if (tx_budget_ms < est_airtime / MIN_TX_BUDGET_AIRTIME_DIV) {
+  unsigned long min_budget = est_airtime / MIN_TX_BUDGET_AIRTIME_DIV;
+  uint8_t class_mask = 0;   // which traffic classes have enough budget
+  for (int c = 0; c < NUM_TX_CLASSES; c++) {
+    if (tx_budget_ms + class_budget_ms[c] >= min_budget) class_mask |= (1 << c);
+  }
+  if (class_mask == 0) {
     float duty_cycle = 1.0f / (1.0f + getAirtimeBudgetFactor());
-    unsigned long needed = est_airtime / MIN_TX_BUDGET_AIRTIME_DIV - tx_budget_ms;
+    unsigned long needed = min_budget - getMaxClassTxBudget();
     next_tx_time = futureMillis((unsigned long)(needed / duty_cycle));
     return;
   }
@@ -303,7 +405,17 @@ void Dispatcher::checkSend() {
   }
   cad_busy_start = 0;  // reset busy state
 
-  outbound = _mgr->getNextOutbound(_ms->getMillis());
+  outbound = NULL;
+  int i = _mgr->findOutboundAtRisk(_ms->getMillis(), est_airtime, class_mask);   // EDF, would a max length packet make one miss its deadline?
+  if (i >= 0) {
+    outbound = _mgr->removeOutboundByIdx(i);
+  }
+  if (outbound == NULL) {
+    outbound = _mgr->getNextOutbound(_ms->getMillis(), class_mask);
+    if (outbound == NULL && class_mask != TX_CLASS_MASK_ALL && _mgr->getOutboundCount(_ms->getMillis()) > 0) {
+      next_tx_time = futureMillis(TX_CLASS_RETRY_MILLIS);   // due packets (not just expired) are all in classes without budget
+    }
+  }
   if (outbound) {
     int len = 0;
     uint8_t raw[MAX_TRANS_UNIT];
@@ -359,6 +471,7 @@ Packet* Dispatcher::obtainNewPacket() {
   } else {
     pkt->payload_len = pkt->path_len = 0;
     pkt->_snr = 0;
+    pkt->invalidateHash();
   }
   return pkt;
 }
@@ -372,10 +485,19 @@ void Dispatcher::sendPacket(Packet* packet, uint8_t priority, uint32_t delay_mil
     MESH_DEBUG_PRINTLN("%s Dispatcher::sendPacket(): ERROR: invalid packet... path_len=%d, payload_len=%d", getLogDateTime(), (uint32_t) packet->path_len, (uint32_t) packet->payload_len);
     _mgr->free(packet);
   } else {
-    _mgr->queueOutbound(packet, priority, futureMillis(delay_millis));
+    packet->_tx_class = packet->getPayloadType() == PAYLOAD_TYPE_ADVERT ? TX_CLASS_ADVERT : TX_CLASS_OWN;
+    _mgr->queueOutbound(packet, priority, futureMillis(delay_millis), 0, calcDeadline(packet, delay_millis));   // own packets don't expire
   }
 }
 
+uint32_t Dispatcher::calcDeadline(const Packet* packet, uint32_t delay_millis) const {
+  uint32_t d = getTxDeadline(packet);
+  if (d == 0) return 0;   // no deadline
+
+  uint32_t deadline = futureMillis(delay_millis + d);
+  return deadline ? deadline : 1;   // zero is reserved for 'none'
+}
+
 // Utility function -- handles the case where millis() wraps around back to zero
 //   2's complement arithmetic will handle any unsigned subtraction up to HALF the word size (32-bits in this case)
 bool Dispatcher::millisHasNowPassed(unsigned long timestamp) const {
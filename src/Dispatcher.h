@@ -36,6 +36,12 @@ public:
   */
   virtual uint32_t getEstAirtimeFor(int len_bytes) = 0;
 
+  /**
+   * \brief  must be called after changing the modulation params (SF, BW, CR, preamble), eg. so cached
+   *        getEstAirtimeFor() values can be discarded.
+  */
+  virtual void onParamsChanged() { }
+
   virtual float packetScore(float snr, int packet_len) = 0;
 
   /**
@@ -69,6 +75,11 @@ public:
 
   virtual bool isInRecvMode() const = 0;
 
+  /**
+   * \returns  true if loop() needs to keep being called without delay (eg. packet waiting to be read, Rx not yet started)
+  */
+  virtual bool needsPolling() const { return false; }
+
   /**
    * \returns  true if the radio is currently mid-receive of a packet.
   */
@@ -78,6 +89,21 @@ public:
   virtual float getLastSNR() const { return 0; }
 };
 
+#define TX_CLASS_OWN           0   // originated by this node
+#define TX_CLASS_DIRECT_FWD    1   // forwarded, direct routed
+#define TX_CLASS_FLOOD_FWD     2   // forwarded, flood routed
+#define TX_CLASS_ADVERT        3   // adverts, own or forwarded
+#define NUM_TX_CLASSES         4
+#define TX_CLASS_MASK_ALL      ((1 << NUM_TX_CLASSES) - 1)
+
+#define DROP_TX_QUEUE_FULL     0   // new outbound packet dropped, queue full (nothing less important to evict)
+#define DROP_TX_EVICTED        1   // queued outbound packet displaced by a more important one
+#define DROP_RX_QUEUE_FULL     2   // inbound packet dropped, queue full
+#define DROP_POOL_EMPTY        3   // allocNew() failed
+#define DROP_TX_EXPIRED        4   // queued outbound packet was past its expiry time
+#define DROP_TX_SUPPRESSED     5   // queued flood retransmit cancelled, enough neighbours heard re-transmitting it
+#define NUM_DROP_REASONS       6
+
 /**
  * \brief  An abstraction for managing instances of Packets (eg. in a static pool),
  *        and for managing the outbound packet queue.
@@ -87,15 +113,59 @@ public:
   virtual Packet* allocNew() = 0;
   virtual void free(Packet* packet) = 0;
 
-  virtual void queueOutbound(Packet* packet, uint8_t priority, uint32_t scheduled_for) = 0;
-  virtual Packet* getNextOutbound(uint32_t now) = 0;    // by priority
+  /**
+   * \param  expires_at  millis time after which packet is no longer worth sending (is silently released), or zero for never
+   * \param  deadline  millis time by which packet should have started transmitting (see findOutboundAtRisk()), or zero for none
+  */
+  virtual void queueOutbound(Packet* packet, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at, uint32_t deadline) = 0;
+  /**
+   * \param  class_mask  bit mask of the TX_CLASS_ values which may be returned (ie. have airtime budget)
+   * \returns  next due packet by priority, skipping (and releasing) expired packets
+  */
+  virtual Packet* getNextOutbound(uint32_t now, uint8_t class_mask) = 0;
   virtual int getOutboundCount(uint32_t now) const = 0;
   virtual int getOutboundTotal() const = 0;
   virtual int getFreeCount() const = 0;
+  virtual int getMaxUsedCount() const = 0;    // high-water mark of packets in use
   virtual Packet* getOutboundByIdx(int i) = 0;
   virtual Packet* removeOutboundByIdx(int i) = 0;
+
+  /**
+   * \returns  index (as per getOutboundByIdx()) of the queued flood packet with this packet hash
+   *        (see Packet::calculatePacketHash()), or -1 if none
+  */
+  virtual int findOutboundFlood(const uint8_t* hash) const = 0;
+
+  /**
+   * \brief  note that the queued outbound packet at index i was heard being re-transmitted by a neighbour.
+   * \param  threshold  cancel (and release) the queued packet once it has been heard this many times
+   * \returns  true if packet was cancelled
+  */
+  virtual bool onOutboundHeard(int i, uint8_t threshold) = 0;
+
+  /**
+   * \brief  for earliest-deadline-first scheduling. Find the due outbound packet which would miss its deadline
+   *       if 'busy_millis' were spent sending something else first (ignores those which have already missed).
+   * \returns  index (as per getOutboundByIdx()) of one with the earliest such deadline, or -1 if none
+  */
+  virtual int findOutboundAtRisk(uint32_t now, uint32_t busy_millis, uint8_t class_mask) = 0;
   virtual void queueInbound(Packet* packet, uint32_t scheduled_for) = 0;
   virtual Packet* getNextInbound(uint32_t now) = 0;
+
+  /**
+   * \param  reason  one of the DROP_* constants
+   * \returns  number of packets dropped for given reason, since last resetDropCounts()
+  */
+  virtual uint32_t getNumDropped(int reason) const = 0;
+  virtual void resetDropCounts() = 0;
+
+  /**
+   * \brief  find the earliest scheduled time amongst the queued outbound (or inbound) packets.
+   * \param  when  (OUT) the earliest 'scheduled_for' time
+   * \returns  false if queue is empty
+  */
+  virtual bool getNextOutboundTime(uint32_t& when) const = 0;
+  virtual bool getNextInboundTime(uint32_t& when) const = 0;
 };
 
 typedef uint32_t  DispatcherAction;
@@ -123,12 +193,16 @@ class Dispatcher {
   bool  prev_isrecv_mode;
   uint32_t n_sent_flood, n_sent_direct;
   uint32_t n_recv_flood, n_recv_direct;
-  unsigned long tx_budget_ms;
+  unsigned long tx_budget_ms;     // shared budget, incl. unused shares of the traffic classes
+  unsigned long class_budget_ms[NUM_TX_CLASSES];   // budgets reserved for each traffic class (see getTxClassShare())
   unsigned long last_budget_update;
   unsigned long duty_cycle_window_ms;
 
   void processRecvPacket(Packet* pkt);
+  uint32_t calcDeadline(const Packet* packet, uint32_t delay_millis) const;
   void updateTxBudget();
+  void spendTxBudget(uint8_t tx_class, unsigned long airtime);
+  unsigned long getMaxClassTxBudget() const;
 
 protected:
   PacketManager* _mgr;
@@ -148,12 +222,19 @@ protected:
     radio_nonrx_start = 0;
     prev_isrecv_mode = true;
     tx_budget_ms = 0;
+    memset(class_budget_ms, 0, sizeof(class_budget_ms));
     last_budget_update = 0;
     duty_cycle_window_ms = 3600000;
   }
 
   virtual DispatcherAction onRecvPacket(Packet* pkt) = 0;
 
+  /**
+   * \brief  release, or queue for retransmit, a received packet, as per the action onRecvPacket() returned.
+   *      For packets that were held (ACTION_MANUAL_HOLD), once sub-class has decided what to do with them.
+  */
+  void applyRecvAction(Packet* pkt, DispatcherAction action);
+
   virtual void logRxRaw(float snr, float rssi, const uint8_t raw[], int len) { }   // custom hook
 
   virtual void logRx(Packet* packet, int len, float score) { }   // hooks for custom logging
@@ -162,6 +243,12 @@ protected:
   virtual const char* getLogDateTime() { return ""; }
 
   virtual float getAirtimeBudgetFactor() const;
+
+  /**
+   * \returns  percentage of the airtime budget reserved for the given TX_CLASS_ value. Any budget not reserved, or
+   *        left unused by a class, is shared by all. Default is zero for all, ie. just one shared budget.
+  */
+  virtual uint8_t getTxClassShare(uint8_t tx_class) const { return 0; }
   virtual int calcRxDelay(float score, uint32_t air_time) const;
   virtual uint32_t getCADFailRetryDelay() const;
   virtual uint32_t getCADFailMaxDuration() const;
@@ -169,17 +256,40 @@ protected:
   virtual int getAGCResetInterval() const { return 0; }    // disabled by default
   virtual unsigned long getDutyCycleWindowMs() const { return 3600000; }
 
+  /**
+   * \returns  number of millis (after its scheduled time) a queued retransmit is still worth sending, or zero for no expiry
+  */
+  virtual uint32_t getRetransmitTTL(const Packet* packet) const { return 0; }
+
+  /**
+   * \returns  number of millis (after its scheduled time) by which packet should have started transmitting, or zero for
+   *        no deadline. Packets at risk of missing their deadline are sent ahead of higher priority ones.
+  */
+  virtual uint32_t getTxDeadline(const Packet* packet) const { return 0; }
+
 public:
   void begin();
   void loop();
 
+  /**
+   * \returns  the millis time when loop() next needs to be called, ie. the earliest of: inbound queue release,
+   *         outbound send time (incl. TX budget refill), radio calibration timers. Until then, the board can
+   *         sleep (or until a radio IRQ).
+  */
+  virtual unsigned long getNextDeadline();
+
+  /**
+   * \returns  number of millis until getNextDeadline(), or zero if loop() has work to do now.
+  */
+  unsigned long getMillisUntilNextDeadline();
+
   Packet* obtainNewPacket();
   void releasePacket(Packet* packet);
   void sendPacket(Packet* packet, uint8_t priority, uint32_t delay_millis=0);
 
   unsigned long getTotalAirTime() const { return total_air_time; }
   unsigned long getReceiveAirTime() const {return rx_air_time; }
-  unsigned long getRemainingTxBudget() const { return tx_budget_ms; }
+  unsigned long getRemainingTxBudget() const;
   uint32_t getNumSentFlood() const { return n_sent_flood; }
   uint32_t getNumSentDirect() const { return n_sent_direct; }
   uint32_t getNumRecvFlood() const { return n_recv_flood; }
@@ -192,10 +302,11 @@ public:
   // helper methods
   bool millisHasNowPassed(unsigned long timestamp) const;
   unsigned long futureMillis(int millis_from_now) const;
+  static unsigned long earliestMillis(unsigned long a, unsigned long b) { return (long)(a - b) < 0 ? a : b; }
 
 private:
   bool tryParsePacket(Packet* pkt, const uint8_t* raw, int len);
-  void checkRecv();
+  bool checkRecv();
   void checkSend();
 };
 
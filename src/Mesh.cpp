@@ -1,14 +1,183 @@
 #include "Mesh.h"
 //#include <Arduino.h>
+#if ADVERT_BATCH_SIZE > 0
+  #include <ed_25519.h>
+#endif
 
 namespace mesh {
 
+#define ADVERT_MESSAGE_MAX_SIZE   (PUB_KEY_SIZE + 4 + MAX_ADVERT_DATA_SIZE)
+
+#if ADVERT_BATCH_SIZE > 0
+static struct AdvertBatchWork {
+  ed25519_batch_entry entries[ADVERT_BATCH_SIZE];
+  uint8_t messages[ADVERT_BATCH_SIZE][ADVERT_MESSAGE_MAX_SIZE];
+} advert_batch_work;   // ~1.9KB per advert, only used within flushAdvertBatch()
+#endif
+
 void Mesh::begin() {
   Dispatcher::begin();
+  clearAnonSecrets();   // self_id may have been (re)assigned since constructed
+  Utils::clearCipherKeys();
 }
 
 void Mesh::loop() {
   Dispatcher::loop();
+#if ADVERT_BATCH_SIZE > 0
+  if (num_pending_adverts > 0 && millisHasNowPassed(pending_adverts_since + ADVERT_BATCH_MILLIS)) {
+    flushAdvertBatch();
+  }
+#endif
+}
+
+unsigned long Mesh::getNextDeadline() {
+  unsigned long deadline = Dispatcher::getNextDeadline();
+#if ADVERT_BATCH_SIZE > 0
+  if (num_pending_adverts > 0) {
+    deadline = earliestMillis(deadline, pending_adverts_since + ADVERT_BATCH_MILLIS);
+  }
+#endif
+  return deadline;
+}
+
+static void calcAdvertKey(const Packet* packet, uint8_t* key) {
+  // NOTE: packet hash is over whole payload (pub_key, timestamp, signature AND app_data), so a valid signature can't be
+  //   re-used with different app_data. It's already cached from isDuplicate(), so no extra SHA256 here.
+  packet->calculatePacketHash(key);
+  memcpy(&key[MAX_HASH_SIZE], &packet->payload[PUB_KEY_SIZE], 4);   // timestamp
+  memcpy(&key[MAX_HASH_SIZE + 4], packet->payload, VERIFIED_ADVERT_KEY_SIZE - MAX_HASH_SIZE - 4);   // pub_key prefix
+}
+
+bool Mesh::isVerifiedAdvert(const Packet* packet, uint8_t* key) {
+#if VERIFIED_ADVERT_CACHE_SIZE > 0
+  calcAdvertKey(packet, key);
+  for (int i = 0; i < num_verified_adverts; i++) {
+    if (memcmp(verified_adverts[i], key, VERIFIED_ADVERT_KEY_SIZE) == 0) return true;
+  }
+#endif
+  return false;
+}
+
+void Mesh::addVerifiedAdvert(const uint8_t* key) {
+#if VERIFIED_ADVERT_CACHE_SIZE > 0
+  memcpy(verified_adverts[next_verified_advert], key, VERIFIED_ADVERT_KEY_SIZE);   // overwrites oldest, when full
+  next_verified_advert = (next_verified_advert + 1) % VERIFIED_ADVERT_CACHE_SIZE;
+  if (num_verified_adverts < VERIFIED_ADVERT_CACHE_SIZE) num_verified_adverts++;
+#endif
+}
+
+void Mesh::clearAnonSecrets() {
+#if ANON_SECRET_CACHE_SIZE > 0
+  memset(anon_secrets, 0, sizeof(anon_secrets));
+  memset(anon_self_key, 0, sizeof(anon_self_key));
+  anon_secret_clock = 0;
+#endif
+}
+
+bool Mesh::findAnonSecret(uint8_t* secret, const uint8_t* sender_pub_key) {
+#if ANON_SECRET_CACHE_SIZE > 0
+  if (memcmp(anon_self_key, self_id.pub_key, PUB_KEY_SIZE) != 0) {
+    clearAnonSecrets();   // identity has changed
+    Utils::clearCipherKeys();   // may hold secrets shared with the old identity
+    memcpy(anon_self_key, self_id.pub_key, PUB_KEY_SIZE);
+    return false;
+  }
+  for (int i = 0; i < ANON_SECRET_CACHE_SIZE; i++) {
+    AnonSecret* s = &anon_secrets[i];
+    if (s->last_used && memcmp(s->pub_key, sender_pub_key, PUB_KEY_SIZE) == 0) {
+      s->last_used = ++anon_secret_clock;
+      memcpy(secret, s->secret, PUB_KEY_SIZE);
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
+void Mesh::addAnonSecret(const uint8_t* secret, const uint8_t* sender_pub_key) {
+#if ANON_SECRET_CACHE_SIZE > 0
+  AnonSecret* lru = &anon_secrets[0];
+  for (int i = 1; i < ANON_SECRET_CACHE_SIZE; i++) {
+    if (anon_secrets[i].last_used < lru->last_used) lru = &anon_secrets[i];
+  }
+  memcpy(lru->pub_key, sender_pub_key, PUB_KEY_SIZE);
+  memcpy(lru->secret, secret, PUB_KEY_SIZE);   // evicted secret is overwritten
+  lru->last_used = ++anon_secret_clock;
+#endif
+}
+
+int Mesh::getAdvertMessage(const Packet* packet, uint8_t* message) const {
+  // signed message is:  {pub_key}{timestamp}{app_data}
+  int app_data_len = packet->payload_len - (PUB_KEY_SIZE + 4 + SIGNATURE_SIZE);
+  if (app_data_len > MAX_ADVERT_DATA_SIZE) { app_data_len = MAX_ADVERT_DATA_SIZE; }
+
+  int msg_len = 0;
+  memcpy(&message[msg_len], packet->payload, PUB_KEY_SIZE + 4); msg_len += PUB_KEY_SIZE + 4;
+  memcpy(&message[msg_len], &packet->payload[PUB_KEY_SIZE + 4 + SIGNATURE_SIZE], app_data_len); msg_len += app_data_len;
+  return msg_len;
+}
+
+DispatcherAction Mesh::onAdvertVerified(Packet* pkt, bool is_ok) {
+  int i = 0;
+  Identity id;
+  memcpy(id.pub_key, &pkt->payload[i], PUB_KEY_SIZE); i += PUB_KEY_SIZE;
+
+  uint32_t timestamp;
+  memcpy(&timestamp, &pkt->payload[i], 4); i += 4;
+  i += SIGNATURE_SIZE;
+
+  uint8_t* app_data = &pkt->payload[i];
+  int app_data_len = pkt->payload_len - i;
+  if (app_data_len > MAX_ADVERT_DATA_SIZE) { app_data_len = MAX_ADVERT_DATA_SIZE; }
+
+  if (is_ok) {
+    MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): valid advertisement received!", getLogDateTime());
+    onAdvertRecv(pkt, id, timestamp, app_data, app_data_len);
+    return routeRecvPacket(pkt);
+  }
+  MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): received advertisement with forged signature! (app_data_len=%d)", getLogDateTime(), app_data_len);
+  return ACTION_RELEASE;
+}
+
+void Mesh::flushAdvertBatch() {
+#if ADVERT_BATCH_SIZE > 0
+  int n = num_pending_adverts;
+  if (n == 0) return;
+  num_pending_adverts = 0;
+
+  AdvertBatchWork* work = &advert_batch_work;
+  const uint8_t* signatures[ADVERT_BATCH_SIZE];
+  const uint8_t* messages[ADVERT_BATCH_SIZE];
+  const uint8_t* pub_keys[ADVERT_BATCH_SIZE];
+  size_t msg_lens[ADVERT_BATCH_SIZE];
+  int valid[ADVERT_BATCH_SIZE];
+  for (int i = 0; i < n; i++) {
+    const Packet* pkt = pending_adverts[i];
+    pub_keys[i] = pkt->payload;
+    signatures[i] = &pkt->payload[PUB_KEY_SIZE + 4];
+    msg_lens[i] = getAdvertMessage(pkt, work->messages[i]);
+    messages[i] = work->messages[i];
+  }
+  uint8_t random[16];
+  _rng->random(random, sizeof(random));
+  ed25519_verify_batch(signatures, messages, msg_lens, pub_keys, n, random, work->entries, valid);
+
+  for (int i = 0; i < n; i++) {
+    Packet* pkt = pending_adverts[i];
+    if (valid[i]) {
+      // NOTE: the batch is cofactored, so also accepts a signature with a small-order component (which only the key's
+      //   owner can make), where Identity::verify() doesn't. Confirm, so result is the same as when not batched
+      Identity id(pkt->payload);
+      valid[i] = id.verify(signatures[i], messages[i], msg_lens[i]);
+    }
+    if (valid[i] && VERIFIED_ADVERT_CACHE_SIZE > 0) {
+      uint8_t key[VERIFIED_ADVERT_KEY_SIZE];
+      calcAdvertKey(pkt, key);
+      addVerifiedAdvert(key);
+    }
+    applyRecvAction(pkt, onAdvertVerified(pkt, valid[i] != 0));
+  }
+#endif
 }
 
 bool Mesh::allowPacketForward(const mesh::Packet* packet) { 
@@ -26,6 +195,38 @@ uint8_t Mesh::getExtraAckTransmitCount() const {
   return 0;
 }
 
+uint32_t Mesh::getRetransmitTTL(const Packet* packet) const {
+  uint32_t ttl = getFloodRetransmitTTL();
+  if (ttl == 0 || !packet->isRouteFlood()) return 0;   // direct packets never expire
+
+  switch (packet->getPayloadType()) {
+    case PAYLOAD_TYPE_ACK:
+    case PAYLOAD_TYPE_PATH:
+    case PAYLOAD_TYPE_RESPONSE:
+      ttl /= 2;   // sender has probably timed out and retried by then
+      break;
+    case PAYLOAD_TYPE_ADVERT:
+      ttl *= 2;   // timestamped, so still useful when late
+      break;
+  }
+  // packets from farther away have already spent longer in transit (and other nodes' queues)
+  return ttl * 8 / (8 + packet->getPathHashCount());
+}
+
+uint32_t Mesh::getTxDeadline(const Packet* packet) const {
+  uint8_t factor = getTxDeadlineAirtimeFactor();
+  if (factor == 0) return 0;
+
+  uint8_t type = packet->getPayloadType();
+  if (type == PAYLOAD_TYPE_MULTIPART && packet->payload_len > 0) {
+    type = packet->payload[0] & 0x0F;   // eg. multipart ACK
+  }
+  if (type == PAYLOAD_TYPE_ACK || type == PAYLOAD_TYPE_PATH || type == PAYLOAD_TYPE_RESPONSE) {
+    return factor * _radio->getEstAirtimeFor(packet->getRawLength()) + TX_DEADLINE_EXTRA_MILLIS;
+  }
+  return 0;   // no deadline
+}
+
 uint32_t Mesh::getCADFailRetryDelay() const {
   return _rng->nextInt(1, 4)*120;
 }
@@ -115,7 +316,7 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       memcpy(&ack_crc, &pkt->payload[i], 4); i += 4;
       if (i > pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete ACK packet", getLogDateTime());
-      } else if (!_tables->hasSeen(pkt)) {
+      } else if (!isDuplicate(pkt)) {
         onAckRecv(pkt, ack_crc);
         action = routeRecvPacket(pkt);
       }
@@ -132,7 +333,7 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       uint8_t* macAndData = &pkt->payload[i];   // MAC + encrypted data 
       if (i + CIPHER_MAC_SIZE >= pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete data packet", getLogDateTime());
-      } else if (!_tables->hasSeen(pkt)) {
+      } else if (!isDuplicate(pkt)) {
         // NOTE: this is a 'first packet wins' impl. When receiving from multiple paths, the first to arrive wins.
         //       For flood mode, the path may not be the 'best' in terms of hops.
         // FUTURE: could send back multiple paths, using createPathReturn(), and let sender choose which to use(?)
@@ -191,17 +392,19 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       uint8_t* macAndData = &pkt->payload[i];   // MAC + encrypted data 
       if (i + 2 >= pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete data packet", getLogDateTime());
-      } else if (!_tables->hasSeen(pkt)) {
+      } else if (!isDuplicate(pkt)) {
         if (self_id.isHashMatch(&dest_hash)) {
           Identity sender(sender_pub_key);
 
           uint8_t secret[PUB_KEY_SIZE];
-          self_id.calcSharedSecret(secret, sender);
+          bool cached = findAnonSecret(secret, sender_pub_key);
+          if (!cached) self_id.calcSharedSecret(secret, sender);   // expensive, so recent senders are cached
 
           // decrypt, checking MAC is valid
           uint8_t data[MAX_PACKET_PAYLOAD];
           int len = Utils::MACThenDecrypt(secret, data, macAndData, pkt->payload_len - i);
           if (len > 0) {  // success!
+            if (!cached) addAnonSecret(secret, sender_pub_key);   // only once MAC is valid, so junk can't flush the cache
             onAnonDataRecv(pkt, secret, sender, data, len);
             pkt->markDoNotRetransmit();
           }
@@ -218,7 +421,7 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       uint8_t* macAndData = &pkt->payload[i];   // MAC + encrypted data 
       if (i + 2 >= pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete data packet", getLogDateTime());
-      } else if (!_tables->hasSeen(pkt)) {
+      } else if (!isDuplicate(pkt)) {
         // scan channels DB, for all matching hashes of 'channel_hash' (max 4 matches supported ATM)
         GroupChannel channels[4];
         int num = searchChannelsByHash(&channel_hash, channels, 4);
@@ -240,38 +443,35 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
       int i = 0;
       Identity id;
       memcpy(id.pub_key, &pkt->payload[i], PUB_KEY_SIZE); i += PUB_KEY_SIZE;
-
-      uint32_t timestamp;
-      memcpy(&timestamp, &pkt->payload[i], 4); i += 4;
+      i += 4;   // timestamp
       const uint8_t* signature = &pkt->payload[i]; i += SIGNATURE_SIZE;
 
       if (i > pkt->payload_len) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): incomplete advertisement packet", getLogDateTime());
       } else if (self_id.matches(id.pub_key)) {
         MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): receiving SELF advert packet", getLogDateTime());
-      } else if (!_tables->hasSeen(pkt)) {
-        uint8_t* app_data = &pkt->payload[i];
-        int app_data_len = pkt->payload_len - i;
-        if (app_data_len > MAX_ADVERT_DATA_SIZE) { app_data_len = MAX_ADVERT_DATA_SIZE; }
-
-        // check that signature is valid
-        bool is_ok;
-        {
-          uint8_t message[PUB_KEY_SIZE + 4 + MAX_ADVERT_DATA_SIZE];
-          int msg_len = 0;
-          memcpy(&message[msg_len], id.pub_key, PUB_KEY_SIZE); msg_len += PUB_KEY_SIZE;
-          memcpy(&message[msg_len], &timestamp, 4); msg_len += 4;
-          memcpy(&message[msg_len], app_data, app_data_len); msg_len += app_data_len;
-
-          is_ok = id.verify(signature, message, msg_len);
+      } else if (!isDuplicate(pkt)) {
+        // check that signature is valid (unless this same advert has already been verified)
+        uint8_t advert_key[VERIFIED_ADVERT_KEY_SIZE];
+        if (isVerifiedAdvert(pkt, advert_key)) {
+          n_advert_verify_skipped++;
+          action = onAdvertVerified(pkt, true);
+#if ADVERT_BATCH_SIZE > 0
+        } else {   // hold, to verify together with others arriving soon (see flushAdvertBatch())
+          if (num_pending_adverts == ADVERT_BATCH_SIZE) flushAdvertBatch();
+          if (num_pending_adverts == 0) pending_adverts_since = _ms->getMillis();
+          pending_adverts[num_pending_adverts++] = pkt;
+          action = ACTION_MANUAL_HOLD;
         }
-        if (is_ok) {
-          MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): valid advertisement received!", getLogDateTime());
-          onAdvertRecv(pkt, id, timestamp, app_data, app_data_len);
-          action = routeRecvPacket(pkt);
+#else
         } else {
-          MESH_DEBUG_PRINTLN("%s Mesh::onRecvPacket(): received advertisement with forged signature! (app_data_len=%d)", getLogDateTime(), app_data_len);
+          uint8_t message[ADVERT_MESSAGE_MAX_SIZE];
+          int msg_len = getAdvertMessage(pkt, message);
+          bool is_ok = id.verify(signature, message, msg_len);
+          if (is_ok) addVerifiedAdvert(advert_key);
+          action = onAdvertVerified(pkt, is_ok);
         }
+#endif
       }
       break;
     }
@@ -315,6 +515,22 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
   return action;
 }
 
+bool Mesh::isDuplicate(const Packet* pkt) {
+  if (!_tables->hasSeen(pkt)) return false;
+
+  uint8_t threshold = getFloodSuppressThreshold();
+  if (threshold > 0 && pkt->isRouteFlood()) {
+    // a neighbour has re-transmitted this. If we still have it queued for re-transmit, maybe cancel ours
+    uint8_t hash[MAX_HASH_SIZE];
+    pkt->calculatePacketHash(hash);   // already cached, by hasSeen()
+    int i = _mgr->findOutboundFlood(hash);
+    if (i >= 0 && _mgr->onOutboundHeard(i, threshold)) {
+      MESH_DEBUG_PRINTLN("%s Mesh::isDuplicate(): flood re-transmit suppressed", getLogDateTime());
+    }
+  }
+  return true;
+}
+
 void Mesh::removeSelfFromPath(Packet* pkt) {
   // remove our hash from 'path'
   pkt->setPathHashCount(pkt->getPathHashCount() - 1);  // decrement the count
@@ -329,6 +545,13 @@ DispatcherAction Mesh::routeRecvPacket(Packet* packet) {
   uint8_t n = packet->getPathHashCount();
   if (packet->isRouteFlood() && !packet->isMarkedDoNotRetransmit()
     && (n + 1)*packet->getPathHashSize() <= MAX_PATH_SIZE && allowPacketForward(packet)) {
+    n_flood_fwd_eligible++;
+    uint8_t pct = getFloodForwardPercent(packet);
+    if (pct < 100 && _rng->nextInt(0, 100) >= pct) {
+      n_flood_fwd_skipped++;
+      return ACTION_RELEASE;   // leave this one to the other neighbours
+    }
+
     // append this node's hash to 'path'
     self_id.copyHashTo(&packet->path[n * packet->getPathHashSize()], packet->getPathHashSize());
     packet->setPathHashCount(n + 1);
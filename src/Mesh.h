@@ -2,6 +2,29 @@
 
 #include <Dispatcher.h>
 
+#ifndef FLOOD_RETRANSMIT_TTL
+  #define FLOOD_RETRANSMIT_TTL   0     // millis, base time-to-live of queued flood retransmits (zero = never expire)
+#endif
+#ifndef TX_DEADLINE_AIRTIME_FACTOR
+  #define TX_DEADLINE_AIRTIME_FACTOR   0     // per-hop deadline for ACK/PATH/RESPONSE, in airtimes (zero = no deadlines)
+#endif
+#ifndef TX_DEADLINE_EXTRA_MILLIS
+  #define TX_DEADLINE_EXTRA_MILLIS     125
+#endif
+#ifndef VERIFIED_ADVERT_CACHE_SIZE
+  #define VERIFIED_ADVERT_CACHE_SIZE   32    // num recent adverts with valid signature remembered, so re-received ones aren't re-verified (zero = disabled)
+#endif
+#define VERIFIED_ADVERT_KEY_SIZE   16    // packet hash, timestamp, then pub_key prefix
+#ifndef ADVERT_BATCH_SIZE
+  #define ADVERT_BATCH_SIZE     0     // max adverts held so their signatures can be verified together (zero = verify each on arrival)
+#endif
+#ifndef ADVERT_BATCH_MILLIS
+  #define ADVERT_BATCH_MILLIS   250   // max time an advert is held, waiting for others to batch with
+#endif
+#ifndef ANON_SECRET_CACHE_SIZE
+  #define ANON_SECRET_CACHE_SIZE   4     // num recent ANON_REQ senders to keep shared-secrets for (zero = disabled)
+#endif
+
 namespace mesh {
 
 class GroupChannel {
@@ -15,6 +38,7 @@ public:
 */
 class MeshTables {
 public:
+  virtual void setClock(MillisecondClock* ms) { }   // optional, for time based expiry of entries
   virtual bool hasSeen(const Packet* packet) = 0;
   virtual void clear(const Packet* packet) = 0;   // remove this packet hash from table
 };
@@ -27,17 +51,67 @@ class Mesh : public Dispatcher {
   RTCClock* _rtc;
   RNG* _rng;
   MeshTables* _tables;
+  uint32_t n_flood_fwd_eligible, n_flood_fwd_skipped;
+  uint32_t n_advert_verify_skipped;
+#if VERIFIED_ADVERT_CACHE_SIZE > 0
+  uint8_t verified_adverts[VERIFIED_ADVERT_CACHE_SIZE][VERIFIED_ADVERT_KEY_SIZE];   // ring of hashes of advert payloads
+  int num_verified_adverts, next_verified_advert;
+#endif
+#if ADVERT_BATCH_SIZE > 0
+  Packet* pending_adverts[ADVERT_BATCH_SIZE];
+  int num_pending_adverts;
+  unsigned long pending_adverts_since;
+#endif
+#if ANON_SECRET_CACHE_SIZE > 0
+  struct AnonSecret {
+    uint8_t pub_key[PUB_KEY_SIZE];   // of sender
+    uint8_t secret[PUB_KEY_SIZE];
+    uint32_t last_used;   // zero = unused
+  };
+  AnonSecret anon_secrets[ANON_SECRET_CACHE_SIZE];
+  uint8_t anon_self_key[PUB_KEY_SIZE];   // self_id when cached, so stale secrets are dropped if identity changes
+  uint32_t anon_secret_clock;
+#endif
 
   void removeSelfFromPath(Packet* packet);
+  bool isDuplicate(const Packet* packet);
   void routeDirectRecvAcks(Packet* packet, uint32_t delay_millis);
   //void routeRecvAcks(Packet* packet, uint32_t delay_millis);
   DispatcherAction forwardMultipartDirect(Packet* pkt);
+  bool isVerifiedAdvert(const Packet* packet, uint8_t* key);
+  void addVerifiedAdvert(const uint8_t* key);
+  int getAdvertMessage(const Packet* packet, uint8_t* message) const;
+  DispatcherAction onAdvertVerified(Packet* packet, bool is_ok);
+  void flushAdvertBatch();
+  bool findAnonSecret(uint8_t* secret, const uint8_t* sender_pub_key);
+  void addAnonSecret(const uint8_t* secret, const uint8_t* sender_pub_key);
 
 protected:
   DispatcherAction onRecvPacket(Packet* pkt) override;
 
   virtual uint32_t getCADFailRetryDelay() const override;
 
+  /**
+   * \returns  time-to-live of a queued flood retransmit, derived from payload type and hop count (see getFloodRetransmitTTL())
+   */
+  virtual uint32_t getRetransmitTTL(const Packet* packet) const override;
+
+  /**
+   * \returns  a deadline for ACK, PATH and RESPONSE packets, ie. what the original sender is waiting on. This is roughly
+   *        this hop's share of the sender's timeout (see getTxDeadlineAirtimeFactor())
+   */
+  virtual uint32_t getTxDeadline(const Packet* packet) const override;
+
+  /**
+   * \returns  base time-to-live (millis) of queued flood retransmits, or zero if they never expire.
+   */
+  virtual uint32_t getFloodRetransmitTTL() const { return FLOOD_RETRANSMIT_TTL; }
+
+  /**
+   * \returns  per-hop deadline for ACK/PATH/RESPONSE packets, in airtimes, or zero for no deadlines (plain priority order).
+   */
+  virtual uint8_t getTxDeadlineAirtimeFactor() const { return TX_DEADLINE_AIRTIME_FACTOR; }
+
   /**
    * \brief  Decide what to do with received packet, ie. discard, forward, or hold
    */
@@ -65,6 +139,18 @@ protected:
    */
   virtual uint32_t getDirectRetransmitDelay(const Packet* packet);
 
+  /**
+   * \returns  number of times a queued flood re-transmit must be heard from neighbours before it is cancelled,
+   *        or zero to always re-transmit.
+   */
+  virtual uint8_t getFloodSuppressThreshold() const { return 0; }
+
+  /**
+   * \returns  probability (percent) of re-transmitting the given flood packet, once allowPacketForward() has passed.
+   *        (ie. a 'gossip' mode, for dense meshes) Default is 100, always re-transmit.
+   */
+  virtual uint8_t getFloodForwardPercent(const Packet* packet) { return 100; }
+
   /**
    * \returns  number of extra (Direct) ACK transmissions wanted.
    */
@@ -168,6 +254,17 @@ protected:
   Mesh(Radio& radio, MillisecondClock& ms, RNG& rng, RTCClock& rtc, PacketManager& mgr, MeshTables& tables)
     : Dispatcher(radio, ms, mgr), _rng(&rng), _rtc(&rtc), _tables(&tables)
   {
+    n_flood_fwd_eligible = n_flood_fwd_skipped = 0;
+    n_advert_verify_skipped = 0;
+#if VERIFIED_ADVERT_CACHE_SIZE > 0
+    num_verified_adverts = next_verified_advert = 0;
+#endif
+#if ADVERT_BATCH_SIZE > 0
+    num_pending_adverts = 0;
+    pending_adverts_since = 0;
+#endif
+    tables.setClock(&ms);
+    clearAnonSecrets();
   }
 
   MeshTables* getTables() const { return _tables; }
@@ -175,12 +272,27 @@ protected:
 public:
   void begin();
   void loop();
+  unsigned long getNextDeadline() override;
 
   LocalIdentity self_id;
 
   RNG* getRNG() const { return _rng; }
   RTCClock* getRTCClock() const { return _rtc; }
 
+  uint32_t getNumFloodFwdEligible() const { return n_flood_fwd_eligible; }   // flood packets allowed to be forwarded
+  uint32_t getNumFloodFwdSkipped() const { return n_flood_fwd_skipped; }     // ... but skipped, as per getFloodForwardPercent()
+  uint32_t getNumAdvertVerifySkipped() const { return n_advert_verify_skipped; }   // adverts whose signature was already verified
+  void resetStats() {
+    Dispatcher::resetStats();
+    n_flood_fwd_eligible = n_flood_fwd_skipped = 0;
+    n_advert_verify_skipped = 0;
+  }
+
+  /**
+   * \brief  wipe the cached shared-secrets of recent ANON_REQ senders
+  */
+  void clearAnonSecrets();
+
   Packet* createAdvert(const LocalIdentity& id, const uint8_t* app_data=NULL, size_t app_data_len=0);
   Packet* createDatagram(uint8_t type, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t len);
   Packet* createAnonDatagram(uint8_t type, const LocalIdentity& sender, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len);
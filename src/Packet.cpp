@@ -8,6 +8,8 @@ Packet::Packet() {
   header = 0;
   path_len = 0;
   payload_len = 0;
+  _tx_class = 0;
+  _hash_key = 0;
 }
 
 bool Packet::isValidPathLen(uint8_t path_len) {
@@ -38,15 +40,27 @@ int Packet::getRawLength() const {
   return 2 + getPathByteLen() + payload_len + (hasTransportCodes() ? 4 : 0);
 }
 
+uint32_t Packet::hashKey() const {
+  uint32_t t = getPayloadType();
+  uint32_t key = 1 | (t << 1) | ((uint32_t)payload_len << 5);   // never zero
+  if (t == PAYLOAD_TYPE_TRACE) key |= (uint32_t)path_len << 16;
+  return key;
+}
+
 void Packet::calculatePacketHash(uint8_t* hash) const {
-  SHA256 sha;
-  uint8_t t = getPayloadType();
-  sha.update(&t, 1);
-  if (t == PAYLOAD_TYPE_TRACE) {
-    sha.update(&path_len, sizeof(path_len));   // CAVEAT: TRACE packets can revisit same node on return path
+  uint32_t key = hashKey();
+  if (key != _hash_key) {
+    SHA256 sha;
+    uint8_t t = getPayloadType();
+    sha.update(&t, 1);
+    if (t == PAYLOAD_TYPE_TRACE) {
+      sha.update(&path_len, sizeof(path_len));   // CAVEAT: TRACE packets can revisit same node on return path
+    }
+    sha.update(payload, payload_len);
+    sha.finalize(_hash, MAX_HASH_SIZE);
+    _hash_key = key;
   }
-  sha.update(payload, payload_len);
-  sha.finalize(hash, MAX_HASH_SIZE);
+  memcpy(hash, _hash, MAX_HASH_SIZE);
 }
 
 uint8_t Packet::writeTo(uint8_t dest[]) const {
@@ -64,6 +78,7 @@ uint8_t Packet::writeTo(uint8_t dest[]) const {
 
 bool Packet::readFrom(const uint8_t src[], uint8_t len) {
   uint8_t i = 0;
+  invalidateHash();
   header = src[i++];
   if (hasTransportCodes()) {
     memcpy(&transport_codes[0], &src[i], 2); i += 2;
@@ -49,13 +49,20 @@ public:
   uint8_t path[MAX_PATH_SIZE];
   uint8_t payload[MAX_PACKET_PAYLOAD];
   int8_t _snr;
+  uint8_t _tx_class;   // one of TX_CLASS_ values (not transmitted)
 
   /**
-   * \brief calculate the hash of payload + type
+   * \brief calculate the hash of payload + type. Result is cached, until type, payload_len (or path_len for TRACE) change,
+   *     or invalidateHash() is called.
    * \param  dest_hash   destination to store the hash (must be MAX_HASH_SIZE bytes)
    */
   void calculatePacketHash(uint8_t* dest_hash) const;
 
+  /**
+   * \brief  must be called if payload[] is modified in-place, after hash may have been calculated
+   */
+  void invalidateHash() { _hash_key = 0; }
+
   /**
    * \returns  one of ROUTE_ values
    */
@@ -109,6 +116,12 @@ public:
    * \param  len  the packet length (as returned by writeTo())
    */
   bool readFrom(const uint8_t src[], uint8_t len);
+
+private:
+  mutable uint8_t _hash[MAX_HASH_SIZE];   // cached calculatePacketHash() result
+  mutable uint32_t _hash_key;             // the hashKey() it was calculated for (zero = none)
+
+  uint32_t hashKey() const;
 };
 
 }
@@ -27,12 +27,89 @@ void Utils::sha256(uint8_t *hash, size_t hash_len, const uint8_t* frag1, int fra
   sha.finalize(hash, hash_len);
 }
 
-int Utils::decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
+#ifndef CIPHER_KEY_CACHE_SIZE   // ~450 bytes per entry
+  #if defined(ESP32) || defined(RP2040_PLATFORM)
+    #define CIPHER_KEY_CACHE_SIZE   4
+  #elif defined(STM32_PLATFORM)
+    #define CIPHER_KEY_CACHE_SIZE   1
+  #else
+    #define CIPHER_KEY_CACHE_SIZE   2
+  #endif
+#endif
+
+#define HMAC_BLOCK_SIZE   64
+
+/*
+ * Recently used shared secrets, with their expanded AES key schedule, and the SHA256 state after the HMAC
+ * inner and outer key pads (midstates). Saves the key setup on every packet (and every trial decrypt).
+ */
+struct CipherKeyEntry {
+  uint8_t secret[PUB_KEY_SIZE];
+  uint32_t last_used;   // zero = unused
   AES128 aes;
+  SHA256 hmac_inner, hmac_outer;
+};
+static CipherKeyEntry key_cache[CIPHER_KEY_CACHE_SIZE];
+static uint32_t key_cache_clock = 0;
+
+static void wipeCipherKey(CipherKeyEntry* e) {
+  memset(e->secret, 0, sizeof(e->secret));
+  e->last_used = 0;
+  e->aes.clear();
+  e->hmac_inner.clear();
+  e->hmac_outer.clear();
+}
+
+void Utils::clearCipherKeys() {
+  for (int i = 0; i < CIPHER_KEY_CACHE_SIZE; i++) {
+    wipeCipherKey(&key_cache[i]);
+  }
+  key_cache_clock = 0;
+}
+
+static CipherKeyEntry* getCipherKey(const uint8_t* shared_secret) {
+  CipherKeyEntry* e = NULL;
+  for (int i = 0; i < CIPHER_KEY_CACHE_SIZE; i++) {
+    CipherKeyEntry* c = &key_cache[i];
+    if (c->last_used && memcmp(c->secret, shared_secret, PUB_KEY_SIZE) == 0) {
+      c->last_used = ++key_cache_clock;
+      return c;   // hit
+    }
+    if (e == NULL || c->last_used < e->last_used) e = c;   // least recently used
+  }
+
+  wipeCipherKey(e);   // evicted: don't leave the old secret, nor anything derived from it
+  memcpy(e->secret, shared_secret, PUB_KEY_SIZE);
+  e->last_used = ++key_cache_clock;
+  e->aes.setKey(shared_secret, CIPHER_KEY_SIZE);
+
+  uint8_t pad[HMAC_BLOCK_SIZE];   // same as SHA256::resetHMAC(), for key len <= block size
+  for (int i = 0; i < HMAC_BLOCK_SIZE; i++) pad[i] = (i < PUB_KEY_SIZE ? shared_secret[i] : 0) ^ 0x36;
+  e->hmac_inner.reset();
+  e->hmac_inner.update(pad, HMAC_BLOCK_SIZE);
+  for (int i = 0; i < HMAC_BLOCK_SIZE; i++) pad[i] ^= 0x36 ^ 0x5C;
+  e->hmac_outer.reset();
+  e->hmac_outer.update(pad, HMAC_BLOCK_SIZE);
+  memset(pad, 0, sizeof(pad));
+  return e;
+}
+
+static void calcHMAC(const CipherKeyEntry* key, uint8_t* mac, const uint8_t* data, int data_len) {
+  uint8_t inner_hash[32];
+  SHA256 sha = key->hmac_inner;
+  sha.update(data, data_len);
+  sha.finalize(inner_hash, sizeof(inner_hash));
+
+  sha = key->hmac_outer;
+  sha.update(inner_hash, sizeof(inner_hash));
+  sha.finalize(mac, CIPHER_MAC_SIZE);
+}
+
+int Utils::decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
+  AES128& aes = getCipherKey(shared_secret)->aes;
   uint8_t* dp = dest;
   const uint8_t* sp = src;
 
-  aes.setKey(shared_secret, CIPHER_KEY_SIZE);
   while (sp - src < src_len) {
     aes.decryptBlock(dp, sp);
     dp += 16; sp += 16;
@@ -42,10 +119,9 @@ int Utils::decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* s
 }
 
 int Utils::encrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
-  AES128 aes;
+  AES128& aes = getCipherKey(shared_secret)->aes;
   uint8_t* dp = dest;
 
-  aes.setKey(shared_secret, CIPHER_KEY_SIZE);
   while (src_len >= 16) {
     aes.encryptBlock(dp, src);
     dp += 16; src += 16; src_len -= 16;
@@ -63,10 +139,7 @@ int Utils::encrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* s
 int Utils::encryptThenMAC(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
   int enc_len = encrypt(shared_secret, dest + CIPHER_MAC_SIZE, src, src_len);
 
-  SHA256 sha;
-  sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-  sha.update(dest + CIPHER_MAC_SIZE, enc_len);
-  sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, dest, CIPHER_MAC_SIZE);
+  calcHMAC(getCipherKey(shared_secret), dest, dest + CIPHER_MAC_SIZE, enc_len);
 
   return CIPHER_MAC_SIZE + enc_len;
 }
@@ -75,12 +148,7 @@ int Utils::MACThenDecrypt(const uint8_t* shared_secret, uint8_t* dest, const uin
   if (src_len <= CIPHER_MAC_SIZE) return 0;  // invalid src bytes
 
   uint8_t hmac[CIPHER_MAC_SIZE];
-  {
-    SHA256 sha;
-    sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-    sha.update(src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
-    sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, hmac, CIPHER_MAC_SIZE);
-  }
+  calcHMAC(getCipherKey(shared_secret), hmac, src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
   if (memcmp(hmac, src, CIPHER_MAC_SIZE) == 0) {
     return decrypt(shared_secret, dest, src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
   }
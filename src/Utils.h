@@ -54,6 +54,11 @@ public:
   */
   static int MACThenDecrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len);
 
+  /**
+   * \brief  wipes the cache of recently used shared secrets (with their AES key schedules and HMAC midstates)
+  */
+  static void clearCipherKeys();
+
   /**
    * \brief  converts 'src' bytes with given length to Hex representation, and null terminates.
   */
@@ -0,0 +1,92 @@
+#include "BloomMeshTables.h"
+
+#define BLOOM_BIT_MASK   (BLOOM_FILTER_BYTES*8 - 1)
+
+BloomMeshTables::BloomMeshTables() {
+  memset(_bits, 0, sizeof(_bits));
+  _curr = _num_added = 0;
+  _num_cleared = 0;
+  _direct_dups = _flood_dups = _num_rotations = 0;
+}
+
+void BloomMeshTables::makeKey(const mesh::Packet* packet, uint8_t* key) const {
+  if (packet->getPayloadType() == PAYLOAD_TYPE_ACK) {
+    // ACK crc is only 4 bytes, so spread it over the key (different mixing to packet hashes)
+    uint32_t crc, h;
+    memcpy(&crc, packet->payload, 4);
+    h = crc * 2654435761UL;
+    h ^= h >> 15;
+    memcpy(key, &crc, 4);
+    memcpy(&key[4], &h, 4);
+    key[0] ^= 0xA5;
+  } else {
+    packet->calculatePacketHash(key);
+  }
+}
+
+bool BloomMeshTables::testAndSet(const uint8_t* key) {
+  uint32_t h1, h2;
+  memcpy(&h1, key, 4);    // key is already a (SHA-256) hash, so use double hashing: h1 + i*h2
+  memcpy(&h2, &key[4], 4);
+  h2 |= 1;   // odd, so never stuck on the one bit
+
+  bool in_curr = true, in_prev = true;
+  uint8_t* curr = _bits[_curr];
+  const uint8_t* prev = _bits[_curr ^ 1];
+  for (int i = 0; i < BLOOM_NUM_HASHES; i++, h1 += h2) {
+    int b = h1 & BLOOM_BIT_MASK;
+    uint8_t m = 1 << (b & 7);
+    if (!(curr[b >> 3] & m)) { in_curr = false; curr[b >> 3] |= m; }
+    if (!(prev[b >> 3] & m)) in_prev = false;
+  }
+  // NOTE: keys only found in 'prev' are also added to 'curr', so packets still echoing around are kept
+  if (!in_curr && ++_num_added >= BLOOM_FILTER_CAPACITY) {   // current filter is full, wipe the oldest and start filling it
+    _curr ^= 1;
+    memset(_bits[_curr], 0, BLOOM_FILTER_BYTES);
+    _num_added = 0;
+    _num_rotations++;
+  }
+  return in_curr || in_prev;
+}
+
+bool BloomMeshTables::takeCleared(const uint8_t* key) {
+  for (int i = 0; i < _num_cleared; i++) {
+    if (memcmp(_cleared[i], key, MAX_HASH_SIZE) == 0) {
+      memmove(_cleared[i], _cleared[i + 1], (_num_cleared - i - 1) * MAX_HASH_SIZE);
+      _num_cleared--;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BloomMeshTables::hasSeen(const mesh::Packet* packet) {
+  uint8_t key[MAX_HASH_SIZE];
+  makeKey(packet, key);
+
+  bool seen = testAndSet(key);
+  if (seen && _num_cleared > 0 && takeCleared(key)) seen = false;   // was clear()'d, treat as new (once)
+
+  if (seen) {
+    if (packet->isRouteDirect()) {
+      _direct_dups++;   // keep some stats
+    } else {
+      _flood_dups++;
+    }
+  }
+  return seen;
+}
+
+void BloomMeshTables::clear(const mesh::Packet* packet) {
+  uint8_t key[MAX_HASH_SIZE];
+  makeKey(packet, key);
+  for (int i = 0; i < _num_cleared; i++) {
+    if (memcmp(_cleared[i], key, MAX_HASH_SIZE) == 0) return;   // already pending
+  }
+
+  if (_num_cleared == BLOOM_MAX_CLEARED) {   // full, forget the oldest
+    memmove(_cleared[0], _cleared[1], (BLOOM_MAX_CLEARED - 1) * MAX_HASH_SIZE);
+    _num_cleared--;
+  }
+  memcpy(_cleared[_num_cleared++], key, MAX_HASH_SIZE);
+}
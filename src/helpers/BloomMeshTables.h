@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Mesh.h>
+
+/*
+ * Each filter has m = BLOOM_FILTER_BYTES*8 bits, and takes up to n = BLOOM_FILTER_CAPACITY entries before the
+ * filters are rotated (oldest one is wiped), so the last n to 2n packets are remembered. With k = BLOOM_NUM_HASHES,
+ * the false-positive (ie. wrongly 'seen') rate of a filter holding n entries is about  (1 - e^(-k*n/m))^k,
+ * and a lookup checks both filters.
+ *   defaults (2 x 512 bytes):  n=400, k=6  =>  worst 1.5%, mean ~1%, remembering 400..800 packets
+ *   n=512, k=4  =>  worst 4.8%,  n=256, k=8  =>  worst 0.1%
+ * (for comparison, SimpleMeshTables uses ~1.3KB for 64 packets and 64 ACKs, with no false-positives)
+ * test/host/bench_seen_tables measures both: ~0.9% false-positives, duplicates caught up to ~400..800 packets back
+*/
+#ifndef BLOOM_FILTER_BYTES
+  #define BLOOM_FILTER_BYTES      512    // per filter (two of them), must be power of 2
+#endif
+#ifndef BLOOM_FILTER_CAPACITY
+  #define BLOOM_FILTER_CAPACITY   400    // entries added before filters are rotated
+#endif
+#ifndef BLOOM_NUM_HASHES
+  #define BLOOM_NUM_HASHES          6
+#endif
+
+#define BLOOM_MAX_CLEARED   4
+
+/**
+ * \brief  A compact, probabilistic alternative to SimpleMeshTables, for low-RAM boards. Uses a rotating pair of
+ *     Bloom filters, so can remember many more recent packets in the same RAM, at the cost of occasional false-positives
+ *     (a new packet wrongly treated as seen). See BLOOM_ defines above for tuning.
+*/
+class BloomMeshTables : public mesh::MeshTables {
+  uint8_t _bits[2][BLOOM_FILTER_BYTES];
+  int _curr, _num_added;
+  uint8_t _cleared[BLOOM_MAX_CLEARED][MAX_HASH_SIZE];   // filters can't delete, so clear() keys are remembered here
+  int _num_cleared;
+  uint32_t _direct_dups, _flood_dups, _num_rotations;
+
+  void makeKey(const mesh::Packet* packet, uint8_t* key) const;
+  bool testAndSet(const uint8_t* key);
+  bool takeCleared(const uint8_t* key);
+
+public:
+  BloomMeshTables();
+
+  bool hasSeen(const mesh::Packet* packet) override;
+  void clear(const mesh::Packet* packet) override;
+
+  uint32_t getNumDirectDups() const { return _direct_dups; }
+  uint32_t getNumFloodDups() const { return _flood_dups; }
+  uint32_t getNumRotations() const { return _num_rotations; }
+
+  void resetStats() { _direct_dups = _flood_dups = 0; }
+};
@@ -60,7 +60,7 @@ void CommonCLI::loadPrefsInt(FILESYSTEM* fs, const char* filename) {
     file.read((uint8_t *)&_prefs->tx_delay_factor, sizeof(_prefs->tx_delay_factor));  // 84
     file.read((uint8_t *)&_prefs->guest_password[0], sizeof(_prefs->guest_password)); // 88
     file.read((uint8_t *)&_prefs->direct_tx_delay_factor, sizeof(_prefs->direct_tx_delay_factor)); // 104
-    file.read(pad, 4); // 108 : 4 bytes unused
+    file.read((uint8_t *)_prefs->airtime_shares, sizeof(_prefs->airtime_shares));                  // 108
     file.read((uint8_t *)&_prefs->sf, sizeof(_prefs->sf));                                         // 112
     file.read((uint8_t *)&_prefs->cr, sizeof(_prefs->cr));                                         // 113
     file.read((uint8_t *)&_prefs->allow_read_only, sizeof(_prefs->allow_read_only));               // 114
@@ -69,7 +69,7 @@ void CommonCLI::loadPrefsInt(FILESYSTEM* fs, const char* filename) {
     file.read((uint8_t *)&_prefs->agc_reset_interval, sizeof(_prefs->agc_reset_interval));         // 120
     file.read((uint8_t *)&_prefs->path_hash_mode, sizeof(_prefs->path_hash_mode));                 // 121
     file.read((uint8_t *)&_prefs->loop_detect, sizeof(_prefs->loop_detect));                       // 122
-    file.read(pad, 1);                                                                             // 123
+    file.read((uint8_t *)&_prefs->flood_suppress, sizeof(_prefs->flood_suppress));                 // 123
     file.read((uint8_t *)&_prefs->flood_max, sizeof(_prefs->flood_max));                           // 124
     file.read((uint8_t *)&_prefs->flood_advert_interval, sizeof(_prefs->flood_advert_interval));   // 125
     file.read((uint8_t *)&_prefs->interference_threshold, sizeof(_prefs->interference_threshold)); // 126
@@ -80,7 +80,8 @@ void CommonCLI::loadPrefsInt(FILESYSTEM* fs, const char* filename) {
     file.read((uint8_t *)&_prefs->bridge_channel, sizeof(_prefs->bridge_channel));                 // 135
     file.read((uint8_t *)&_prefs->bridge_secret, sizeof(_prefs->bridge_secret));                   // 136
     file.read((uint8_t *)&_prefs->powersaving_enabled, sizeof(_prefs->powersaving_enabled));       // 152
-    file.read(pad, 3);                                                                             // 153
+    file.read((uint8_t *)&_prefs->flood_gossip_k, sizeof(_prefs->flood_gossip_k));                 // 153
+    file.read(pad, 2);                                                                             // 154
     file.read((uint8_t *)&_prefs->gps_enabled, sizeof(_prefs->gps_enabled));                       // 156
     file.read((uint8_t *)&_prefs->gps_interval, sizeof(_prefs->gps_interval));                     // 157
     file.read((uint8_t *)&_prefs->advert_loc_policy, sizeof (_prefs->advert_loc_policy));          // 161
@@ -102,6 +103,11 @@ void CommonCLI::loadPrefsInt(FILESYSTEM* fs, const char* filename) {
     _prefs->multi_acks = constrain(_prefs->multi_acks, 0, 1);
     _prefs->adc_multiplier = constrain(_prefs->adc_multiplier, 0.0f, 10.0f);
     _prefs->path_hash_mode = constrain(_prefs->path_hash_mode, 0, 2);   // NOTE: mode 3 reserved for future
+    _prefs->flood_suppress = constrain(_prefs->flood_suppress, 0, 8);
+    _prefs->flood_gossip_k = constrain(_prefs->flood_gossip_k, 0, 32);
+    if (_prefs->airtime_shares[0] + _prefs->airtime_shares[1] + _prefs->airtime_shares[2] + _prefs->airtime_shares[3] > 100) {
+      memset(_prefs->airtime_shares, 0, sizeof(_prefs->airtime_shares));
+    }
 
     // sanitise bad bridge pref values
     _prefs->bridge_enabled = constrain(_prefs->bridge_enabled, 0, 1);
@@ -150,7 +156,7 @@ void CommonCLI::savePrefs(FILESYSTEM* fs) {
     file.write((uint8_t *)&_prefs->tx_delay_factor, sizeof(_prefs->tx_delay_factor));  // 84
     file.write((uint8_t *)&_prefs->guest_password[0], sizeof(_prefs->guest_password)); // 88
     file.write((uint8_t *)&_prefs->direct_tx_delay_factor, sizeof(_prefs->direct_tx_delay_factor)); // 104
-    file.write(pad, 4); // 108 : 4 byte unused
+    file.write((uint8_t *)_prefs->airtime_shares, sizeof(_prefs->airtime_shares));                  // 108
     file.write((uint8_t *)&_prefs->sf, sizeof(_prefs->sf));                                         // 112
     file.write((uint8_t *)&_prefs->cr, sizeof(_prefs->cr));                                         // 113
     file.write((uint8_t *)&_prefs->allow_read_only, sizeof(_prefs->allow_read_only));               // 114
@@ -159,7 +165,7 @@ void CommonCLI::savePrefs(FILESYSTEM* fs) {
     file.write((uint8_t *)&_prefs->agc_reset_interval, sizeof(_prefs->agc_reset_interval));         // 120
     file.write((uint8_t *)&_prefs->path_hash_mode, sizeof(_prefs->path_hash_mode));                 // 121
     file.write((uint8_t *)&_prefs->loop_detect, sizeof(_prefs->loop_detect));                       // 122
-    file.write(pad, 1);                                                                             // 123
+    file.write((uint8_t *)&_prefs->flood_suppress, sizeof(_prefs->flood_suppress));                 // 123
     file.write((uint8_t *)&_prefs->flood_max, sizeof(_prefs->flood_max));                           // 124
     file.write((uint8_t *)&_prefs->flood_advert_interval, sizeof(_prefs->flood_advert_interval));   // 125
     file.write((uint8_t *)&_prefs->interference_threshold, sizeof(_prefs->interference_threshold)); // 126
@@ -170,7 +176,8 @@ void CommonCLI::savePrefs(FILESYSTEM* fs) {
     file.write((uint8_t *)&_prefs->bridge_channel, sizeof(_prefs->bridge_channel));                 // 135
     file.write((uint8_t *)&_prefs->bridge_secret, sizeof(_prefs->bridge_secret));                   // 136
     file.write((uint8_t *)&_prefs->powersaving_enabled, sizeof(_prefs->powersaving_enabled));       // 152
-    file.write(pad, 3);                                                                             // 153
+    file.write((uint8_t *)&_prefs->flood_gossip_k, sizeof(_prefs->flood_gossip_k));                 // 153
+    file.write(pad, 2);                                                                             // 154
     file.write((uint8_t *)&_prefs->gps_enabled, sizeof(_prefs->gps_enabled));                       // 156
     file.write((uint8_t *)&_prefs->gps_interval, sizeof(_prefs->gps_interval));                     // 157
     file.write((uint8_t *)&_prefs->advert_loc_policy, sizeof(_prefs->advert_loc_policy));           // 161
@@ -209,10 +216,12 @@ void CommonCLI::handleCommand(uint32_t sender_timestamp, const char* command, ch
     if (memcmp(command, "poweroff", 8) == 0 || memcmp(command, "shutdown", 8) == 0) {
       _board->powerOff();  // doesn't return
     } else if (memcmp(command, "reboot", 6) == 0) {
+      _callbacks->onBeforeReboot();
       _board->reboot();  // doesn't return
     } else if (memcmp(command, "clkreboot", 9) == 0) {
       // Reset clock
       getRTCClock()->setCurrentTime(1715770351);  // 15 May 2024, 8:50pm
+      _callbacks->onBeforeReboot();
       _board->reboot();  // doesn't return
      } else if (memcmp(command, "advert.zerohop", 14) == 0 && (command[14] == 0 || command[14] == ' ')) {
       // send zerohop advert
@@ -336,6 +345,19 @@ void CommonCLI::handleCommand(uint32_t sender_timestamp, const char* command, ch
         sprintf(reply, "> %s", StrHelper::ftoa(_prefs->tx_delay_factor));
       } else if (memcmp(config, "flood.max", 9) == 0) {
         sprintf(reply, "> %d", (uint32_t)_prefs->flood_max);
+      } else if (memcmp(config, "flood.suppress", 14) == 0 && !_callbacks->hasForwardingPrefs()) {
+        strcpy(reply, "Error: unsupported by this firmware");
+      } else if (memcmp(config, "flood.suppress", 14) == 0) {
+        sprintf(reply, "> %d", (uint32_t)_prefs->flood_suppress);
+      } else if (memcmp(config, "flood.gossip", 12) == 0 && !_callbacks->hasForwardingPrefs()) {
+        strcpy(reply, "Error: unsupported by this firmware");
+      } else if (memcmp(config, "flood.gossip", 12) == 0) {
+        sprintf(reply, "> %d", (uint32_t)_prefs->flood_gossip_k);
+      } else if (memcmp(config, "airtime.shares", 14) == 0 && !_callbacks->hasForwardingPrefs()) {
+        strcpy(reply, "Error: unsupported by this firmware");
+      } else if (memcmp(config, "airtime.shares", 14) == 0) {
+        sprintf(reply, "> %d,%d,%d,%d", (uint32_t)_prefs->airtime_shares[0], (uint32_t)_prefs->airtime_shares[1],
+                (uint32_t)_prefs->airtime_shares[2], (uint32_t)_prefs->airtime_shares[3]);
       } else if (memcmp(config, "direct.txdelay", 14) == 0) {
         sprintf(reply, "> %s", StrHelper::ftoa(_prefs->direct_tx_delay_factor));
       } else if (memcmp(config, "owner.info", 10) == 0) {
@@ -578,6 +600,47 @@ void CommonCLI::handleCommand(uint32_t sender_timestamp, const char* command, ch
         } else {
           strcpy(reply, "Error, max 64");
         }
+      } else if (memcmp(config, "flood.suppress ", 15) == 0 && !_callbacks->hasForwardingPrefs()) {
+        strcpy(reply, "Error: unsupported by this firmware");
+      } else if (memcmp(config, "flood.suppress ", 15) == 0) {
+        int n = atoi(&config[15]);
+        if (n >= 0 && n <= 8) {
+          _prefs->flood_suppress = n;
+          savePrefs();
+          strcpy(reply, "OK");
+        } else {
+          strcpy(reply, "Error, range is 0-8");
+        }
+      } else if (memcmp(config, "flood.gossip ", 13) == 0 && !_callbacks->hasForwardingPrefs()) {
+        strcpy(reply, "Error: unsupported by this firmware");
+      } else if (memcmp(config, "flood.gossip ", 13) == 0) {
+        int k = atoi(&config[13]);
+        if (k >= 0 && k <= 32) {
+          _prefs->flood_gossip_k = k;
+          savePrefs();
+          strcpy(reply, "OK");
+        } else {
+          strcpy(reply, "Error, range is 0-32");
+        }
+      } else if (memcmp(config, "airtime.shares ", 15) == 0 && !_callbacks->hasForwardingPrefs()) {
+        strcpy(reply, "Error: unsupported by this firmware");
+      } else if (memcmp(config, "airtime.shares ", 15) == 0) {
+        strcpy(tmp, &config[15]);
+        const char *parts[4];
+        int num = mesh::Utils::parseTextParts(tmp, parts, 4);
+        int shares[4], total = 0;
+        for (int i = 0; i < 4; i++) {
+          shares[i] = i < num ? atoi(parts[i]) : 0;
+          if (shares[i] < 0) total = 999;
+          total += shares[i];
+        }
+        if (num == 4 && total <= 100) {
+          for (int i = 0; i < 4; i++) _prefs->airtime_shares[i] = shares[i];
+          savePrefs();
+          strcpy(reply, "OK");
+        } else {
+          strcpy(reply, "Error, need 4 percentages, max total 100");
+        }
       } else if (memcmp(config, "direct.txdelay ", 15) == 0) {
         float f = atof(&config[15]);
         if (f >= 0) {
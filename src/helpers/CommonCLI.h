@@ -60,6 +60,9 @@ struct NodePrefs { // persisted to file
   uint8_t rx_boosted_gain; // power settings
   uint8_t path_hash_mode;   // which path mode to use when sending
   uint8_t loop_detect;
+  uint8_t flood_suppress;   // cancel queued flood re-transmit once heard from this many neighbours (0 = disabled)
+  uint8_t airtime_shares[4];   // percent of airtime budget reserved for: own, direct forwards, flood forwards, adverts (see TX_CLASS_)
+  uint8_t flood_gossip_k;   // gossip mode: target number of neighbours to forward each flood packet (0 = disabled, always forward)
 };
 
 class CommonCLICallbacks {
@@ -99,6 +102,15 @@ public:
   virtual void setRxBoostedGain(bool enable) {
     // no op by default
   };
+
+  virtual void onBeforeReboot() {
+    // no op by default
+  };
+
+  /**
+   * \returns  true if this firmware forwards packets using the flood.suppress, flood.gossip and airtime.shares prefs
+  */
+  virtual bool hasForwardingPrefs() const { return false; }
 };
 
 class CommonCLI {
@@ -46,6 +46,7 @@ RegionMap::RegionMap(TransportKeyStore& store) : _store(&store) {
   wildcard.id = wildcard.parent = 0;
   wildcard.flags = 0;  // default behaviour, allow flood and direct
   strcpy(wildcard.name, "*");
+  invalidate();
 }
 
 bool RegionMap::is_name_char(uint8_t c) {
@@ -68,41 +69,114 @@ static File openWrite(FILESYSTEM* _fs, const char* filename) {
   #endif
 }
 
-bool RegionMap::load(FILESYSTEM* _fs, const char* path) {
-  if (_fs->exists(path ? path : "/regions2")) {
+/*
+ * Region file format:  {magic (4)}{home_id (2)}{wildcard flags (1)}{next_id (2)}{num regions (2)}
+ *   then per region:   {id (2)}{parent (2)}{flags (1)}{name len (1)}{name (no null terminator)}
+ * The legacy "/regions2" file (fixed size records, with 128 byte padding) is still read, and (for now) also written
+ * on save(), so a firmware downgrade keeps its regions. Its reserved header is marked, so a "/regions2" saved by an
+ * older firmware (after a downgrade) can be recognised as newer than "/regions3".
+*/
+#define REGIONS_FILE          "/regions3"
+#define REGIONS_LEGACY_FILE   "/regions2"
+#define REGIONS_MAGIC         0x334E4752    // "RGN3"
+#define REGIONS_LEGACY_MARK   0x324E4752    // "RGN2", in reserved header of a "/regions2" written alongside "/regions3"
+#define REGION_HEADER_SIZE    6             // per region, before name
+
+#ifndef REGIONS_SAVE_LEGACY
+  #define REGIONS_SAVE_LEGACY   1     // also write "/regions2" on save(), for downgrades
+#endif
+
+static File openRead(FILESYSTEM* _fs, const char* filename) {
   #if defined(RP2040_PLATFORM)
-    File file = _fs->open(path ? path : "/regions2", "r");
+    return _fs->open(filename, "r");
   #else
-    File file = _fs->open(path ? path : "/regions2");
+    return _fs->open(filename);
   #endif
+}
 
-    if (file) {
-      uint8_t pad[128];
+// true if "/regions2" was saved by an older firmware, ie. after the last "/regions3" was saved
+static bool isLegacyNewer(FILESYSTEM* _fs) {
+  if (!_fs->exists(REGIONS_LEGACY_FILE)) return false;
 
-      num_regions = 0; next_id = 1; home_id = 0;
+  File file = openRead(_fs, REGIONS_LEGACY_FILE);
+  if (!file) return false;
+  uint32_t mark = 0;
+  file.read((uint8_t *) &mark, sizeof(mark));
+  file.close();
+  return mark != REGIONS_LEGACY_MARK;
+}
+
+bool RegionMap::loadLegacy(File& file) {
+  uint8_t pad[128];
+
+  bool success = file.read(pad, 1) == 1;  // rest of reserved header (first 4 bytes already read)
+  success = success && file.read((uint8_t *) &home_id, sizeof(home_id)) == sizeof(home_id);
+  success = success && file.read((uint8_t *) &wildcard.flags, sizeof(wildcard.flags)) == sizeof(wildcard.flags);
+  success = success && file.read((uint8_t *) &next_id, sizeof(next_id)) == sizeof(next_id);
+
+  if (success) {
+    while (num_regions < MAX_REGION_ENTRIES) {
+      auto r = &regions[num_regions];
+
+      success = file.read((uint8_t *) &r->id, sizeof(r->id)) == sizeof(r->id);
+      success = success && file.read((uint8_t *) &r->parent, sizeof(r->parent)) == sizeof(r->parent);
+      success = success && file.read((uint8_t *) r->name, sizeof(r->name)) == sizeof(r->name);
+      success = success && file.read((uint8_t *) &r->flags, sizeof(r->flags)) == sizeof(r->flags);
+      success = success && file.read(pad, sizeof(pad)) == sizeof(pad);
+
+      if (!success) break; // EOF
+
+      if (r->id >= next_id) {    // make sure next_id is valid
+        next_id = r->id + 1;
+      }
+      num_regions++;
+    }
+  }
+  return true;
+}
 
-      bool success = file.read(pad, 5) == 5;  // reserved header
+bool RegionMap::load(FILESYSTEM* _fs, const char* path) {
+  if (path == NULL) {
+    path = _fs->exists(REGIONS_FILE) && !isLegacyNewer(_fs) ? REGIONS_FILE : REGIONS_LEGACY_FILE;
+  }
+  if (_fs->exists(path)) {
+    File file = openRead(_fs, path);
+
+    if (file) {
+      num_regions = 0; next_id = 1; home_id = 0;
+      invalidate();
+
+      uint32_t magic = 0;
+      uint16_t num = 0;
+      bool success = file.read((uint8_t *) &magic, sizeof(magic)) == sizeof(magic);
+      if (success && magic != REGIONS_MAGIC) {
+        loadLegacy(file);
+        file.close();
+        return true;
+      }
       success = success && file.read((uint8_t *) &home_id, sizeof(home_id)) == sizeof(home_id);
       success = success && file.read((uint8_t *) &wildcard.flags, sizeof(wildcard.flags)) == sizeof(wildcard.flags);
       success = success && file.read((uint8_t *) &next_id, sizeof(next_id)) == sizeof(next_id);
+      success = success && file.read((uint8_t *) &num, sizeof(num)) == sizeof(num);
 
-      if (success) {
-        while (num_regions < MAX_REGION_ENTRIES) {
-          auto r = &regions[num_regions];
+      while (success && num_regions < num && num_regions < MAX_REGION_ENTRIES) {
+        auto r = &regions[num_regions];
+        uint8_t hdr[REGION_HEADER_SIZE];
 
-          success = file.read((uint8_t *) &r->id, sizeof(r->id)) == sizeof(r->id);
-          success = success && file.read((uint8_t *) &r->parent, sizeof(r->parent)) == sizeof(r->parent);
-          success = success && file.read((uint8_t *) r->name, sizeof(r->name)) == sizeof(r->name);
-          success = success && file.read((uint8_t *) &r->flags, sizeof(r->flags)) == sizeof(r->flags);
-          success = success && file.read(pad, sizeof(pad)) == sizeof(pad);
+        success = file.read(hdr, sizeof(hdr)) == sizeof(hdr);
+        if (!success || hdr[5] >= sizeof(r->name)) break;   // EOF, or corrupt
 
-          if (!success) break; // EOF
+        memcpy(&r->id, &hdr[0], 2);
+        memcpy(&r->parent, &hdr[2], 2);
+        r->flags = hdr[4];
+        success = file.read((uint8_t *) r->name, hdr[5]) == hdr[5];
+        r->name[hdr[5]] = 0;
+        if (!success) break;   // EOF
 
-          if (r->id >= next_id) {    // make sure next_id is valid
-            next_id = r->id + 1;
-          }
-          num_regions++;
+        if (r->id >= next_id) {    // make sure next_id is valid
+          next_id = r->id + 1;
         }
+        num_regions++;
       }
       file.close();
       return true;
@@ -112,30 +186,63 @@ bool RegionMap::load(FILESYSTEM* _fs, const char* path) {
 }
 
 bool RegionMap::save(FILESYSTEM* _fs, const char* path) {
-  File file = openWrite(_fs, path ? path : "/regions2");
+  File file = openWrite(_fs, path ? path : REGIONS_FILE);
+  if (file) {
+    uint32_t magic = REGIONS_MAGIC;
+    uint16_t num = num_regions;
+
+    bool success = file.write((uint8_t *) &magic, sizeof(magic)) == sizeof(magic);
+    success = success && file.write((uint8_t *) &home_id, sizeof(home_id)) == sizeof(home_id);
+    success = success && file.write((uint8_t *) &wildcard.flags, sizeof(wildcard.flags)) == sizeof(wildcard.flags);
+    success = success && file.write((uint8_t *) &next_id, sizeof(next_id)) == sizeof(next_id);
+    success = success && file.write((uint8_t *) &num, sizeof(num)) == sizeof(num);
+
+    for (int i = 0; success && i < num_regions; i++) {
+      auto r = &regions[i];
+      uint8_t rec[REGION_HEADER_SIZE + sizeof(r->name)];
+      int len = strlen(r->name);
+
+      memcpy(&rec[0], &r->id, 2);
+      memcpy(&rec[2], &r->parent, 2);
+      rec[4] = r->flags;
+      rec[5] = len;
+      memcpy(&rec[REGION_HEADER_SIZE], r->name, len);
+      success = file.write(rec, REGION_HEADER_SIZE + len) == REGION_HEADER_SIZE + len;
+    }
+    file.close();
+
+  #if REGIONS_SAVE_LEGACY
+    if (success && path == NULL) success = saveLegacy(_fs);
+  #endif
+    return success;
+  }
+  return false;  // failed
+}
+
+bool RegionMap::saveLegacy(FILESYSTEM* _fs) {
+  File file = openWrite(_fs, REGIONS_LEGACY_FILE);
   if (file) {
     uint8_t pad[128];
     memset(pad, 0, sizeof(pad));
+    uint32_t mark = REGIONS_LEGACY_MARK;
 
-    bool success = file.write(pad, 5) == 5;  // reserved header
+    bool success = file.write((uint8_t *) &mark, sizeof(mark)) == sizeof(mark);   // reserved header
+    success = success && file.write(pad, 1) == 1;
     success = success && file.write((uint8_t *) &home_id, sizeof(home_id)) == sizeof(home_id);
     success = success && file.write((uint8_t *) &wildcard.flags, sizeof(wildcard.flags)) == sizeof(wildcard.flags);
     success = success && file.write((uint8_t *) &next_id, sizeof(next_id)) == sizeof(next_id);
 
-    if (success) {
-      for (int i = 0; i < num_regions; i++) {
-        auto r = &regions[i];
+    for (int i = 0; success && i < num_regions; i++) {
+      auto r = &regions[i];
 
-        success = file.write((uint8_t *) &r->id, sizeof(r->id)) == sizeof(r->id);
-        success = success && file.write((uint8_t *) &r->parent, sizeof(r->parent)) == sizeof(r->parent);
-        success = success && file.write((uint8_t *) r->name, sizeof(r->name)) == sizeof(r->name);
-        success = success && file.write((uint8_t *) &r->flags, sizeof(r->flags)) == sizeof(r->flags);
-        success = success && file.write(pad, sizeof(pad)) == sizeof(pad);
-        if (!success) break; // write failed
-      }
+      success = file.write((uint8_t *) &r->id, sizeof(r->id)) == sizeof(r->id);
+      success = success && file.write((uint8_t *) &r->parent, sizeof(r->parent)) == sizeof(r->parent);
+      success = success && file.write((uint8_t *) r->name, sizeof(r->name)) == sizeof(r->name);
+      success = success && file.write((uint8_t *) &r->flags, sizeof(r->flags)) == sizeof(r->flags);
+      success = success && file.write(pad, sizeof(pad)) == sizeof(pad);
     }
     file.close();
-    return true;
+    return success;
   }
   return false;  // failed
 }
@@ -151,56 +258,239 @@ RegionEntry* RegionMap::putRegion(const char* name, uint16_t parent_id, uint16_t
   if (region) {
     if (region->id == parent_id) return NULL;   // ERROR: invalid parent!
 
+    invalidate();
     region->parent = parent_id;   // re-parent / move this region in the hierarchy
   } else {
     if (id == 0 && num_regions >= MAX_REGION_ENTRIES) return NULL;  // full!
 
+    invalidateMatches();
     region = &regions[num_regions++];   // alloc new RegionEntry
     region->flags = REGION_DENY_FLOOD;     // DENY by default
     region->id = id == 0 ? next_id++ : id;
     StrHelper::strncpy(region->name, name, sizeof(region->name));
     region->parent = parent_id;
+    addToIndex(num_regions - 1);   // cheaper than a rebuild, for bulk loads
   }
   return region;
 }
 
+int RegionMap::loadRegionKeys(const RegionEntry* region, TransportKey keys[], int max_num) {
+  if (region->name[0] == '$') {   // private region
+    return _store->loadKeysFor(region->id, keys, max_num);
+  }
+  if (region->name[0] == '#') {   // auto hashtag region
+    _store->getAutoKeyFor(region->id, region->name, keys[0]);
+  } else {   // new: implicit auto hashtag region
+    char tmp[sizeof(region->name)];
+    tmp[0] = '#';
+    strcpy(&tmp[1], region->name);
+    _store->getAutoKeyFor(region->id, tmp, keys[0]);
+  }
+  return 1;
+}
+
+void RegionMap::prepareKeys() {
+  if (match.state == NULL) match.state = new MatchState();
+  auto st = match.state;
+
+  int n = 0;
+  for (int i = 0; i < num_regions; i++) {
+    TransportKey keys[4];
+    int num = loadRegionKeys(&regions[i], keys, 4);
+    if (n + num <= REGION_KEY_STATES) {
+      st->region_keys_at[i] = n;
+      st->region_num_keys[i] = num;
+      for (int j = 0; j < num; j++) {
+        st->key_states[n++].prepare(keys[j]);
+      }
+    } else {
+      st->region_keys_at[i] = -1;   // no room, findMatch() will have to use the slower path
+    }
+  }
+  st->keys_version = _store->getVersion();
+  st->num_recent = st->next_recent = 0;   // key changes make results stale
+  match.dirty = false;
+}
+
+bool RegionMap::regionKeyMatches(int idx, const mesh::Packet* packet) {
+  auto st = match.state;
+  if (st->region_keys_at[idx] >= 0) {
+    auto k = &st->key_states[st->region_keys_at[idx]];
+    for (int j = 0; j < st->region_num_keys[idx]; j++, k++) {
+      if (packet->transport_codes[0] == k->calcTransportCode(packet)) return true;
+    }
+  } else {
+    TransportKey keys[4];
+    int num = loadRegionKeys(&regions[idx], keys, 4);
+    for (int j = 0; j < num; j++) {
+      if (packet->transport_codes[0] == keys[j].calcTransportCode(packet)) return true;
+    }
+  }
+  return false;
+}
+
+RegionMap::MatchResult* RegionMap::getMatchResult(const mesh::Packet* packet) {
+  auto st = match.state;
+  uint8_t hash[MAX_HASH_SIZE];
+  packet->calculatePacketHash(hash);
+
+  for (int i = 0; i < st->num_recent; i++) {
+    auto m = &st->recent_matches[i];
+    if (m->code == packet->transport_codes[0] && memcmp(m->hash, hash, MAX_HASH_SIZE) == 0) return m;  // seen this packet
+  }
+
+  auto m = &st->recent_matches[st->next_recent];   // replace oldest
+  st->next_recent = (st->next_recent + 1) % REGION_MATCH_CACHE_SIZE;
+  if (st->num_recent < REGION_MATCH_CACHE_SIZE) st->num_recent++;
+
+  memcpy(m->hash, hash, MAX_HASH_SIZE);
+  m->code = packet->transport_codes[0];
+  memset(m->checked, 0, sizeof(m->checked));
+  memset(m->matched, 0, sizeof(m->matched));
+  return m;
+}
+
 RegionEntry* RegionMap::findMatch(mesh::Packet* packet, uint8_t mask) {
+  if (match.dirty || match.state->keys_version != _store->getVersion()) prepareKeys();
+
+  auto m = getMatchResult(packet);
   for (int i = 0; i < num_regions; i++) {
     auto region = &regions[i];
     if ((region->flags & mask) == 0) {   // does region allow this? (per 'mask' param)
-      TransportKey keys[4];
-      int num;
-      if (region->name[0] == '$') {   // private region
-        num = _store->loadKeysFor(region->id, keys, 4);
-      } else if (region->name[0] == '#') {   // auto hashtag region
-        _store->getAutoKeyFor(region->id, region->name, keys[0]);
-        num = 1;
-      } else {   // new: implicit auto hashtag region
-        char tmp[sizeof(region->name)];
-        tmp[0] = '#';
-        strcpy(&tmp[1], region->name);
-        _store->getAutoKeyFor(region->id, tmp, keys[0]);
-        num = 1;
+      uint32_t bit = 1UL << (i & 31);
+      if ((m->checked[i >> 5] & bit) == 0) {   // not already checked for this packet
+        m->checked[i >> 5] |= bit;
+        if (regionKeyMatches(i, packet)) m->matched[i >> 5] |= bit;
       }
-      for (int j = 0; j < num; j++) {
-        uint16_t code = keys[j].calcTransportCode(packet);
-        if (packet->transport_codes[0] == code) {   // a match!!
-          return region;
-        }
+      if (m->matched[i >> 5] & bit) {   // a match!!
+        return region;
       }
     }
   }
   return NULL;  // no matches
 }
 
+void RegionMap::buildIndex() const {
+  // sort by name, and by id (shell sort, as can be a few hundred entries)
+  for (int i = 0; i < num_regions; i++) {
+    by_name[i] = by_id[i] = i;
+  }
+  for (int gap = num_regions / 2; gap > 0; gap /= 2) {
+    for (int i = gap; i < num_regions; i++) {
+      uint16_t t = by_name[i];
+      int j = i;
+      while (j >= gap && strcmp(skip_hash(regions[by_name[j - gap]].name), skip_hash(regions[t].name)) > 0) {
+        by_name[j] = by_name[j - gap];
+        j -= gap;
+      }
+      by_name[j] = t;
+
+      t = by_id[i];
+      j = i;
+      while (j >= gap && regions[by_id[j - gap]].id > regions[t].id) {
+        by_id[j] = by_id[j - gap];
+        j -= gap;
+      }
+      by_id[j] = t;
+    }
+  }
+
+  // child lists, kept in array order (so exportTo() order is unchanged)
+  root_first_child = -1;
+  for (int i = 0; i < num_regions; i++) {
+    first_child[i] = -1;
+  }
+  index_dirty = false;   // NOTE: findIdxById() is now valid
+  for (int i = num_regions - 1; i >= 0; i--) {
+    if (regions[i].parent == 0) {
+      next_sibling[i] = root_first_child;
+      root_first_child = i;
+    } else {
+      int p = findIdxById(regions[i].parent);
+      if (p >= 0) {
+        next_sibling[i] = first_child[p];
+        first_child[p] = i;
+      } else {
+        next_sibling[i] = -1;   // orphan
+      }
+    }
+  }
+}
+
+void RegionMap::addToIndex(int idx) {
+  if (index_dirty) return;   // will be rebuilt anyway
+
+  num_regions--;   // search the index without the new entry
+  int16_t* link = &root_first_child;   // append to end of parent's child list
+  if (regions[idx].parent != 0) {
+    int p = findIdxById(regions[idx].parent);
+    if (p < 0) {   // orphan (parent may be added later), leave to a full rebuild
+      num_regions++;
+      index_dirty = true;
+      return;
+    }
+    link = &first_child[p];
+  }
+
+  int i = lowerBoundByName(skip_hash(regions[idx].name));
+  memmove(&by_name[i + 1], &by_name[i], (num_regions - i) * sizeof(by_name[0]));
+  by_name[i] = idx;
+
+  int lo = 0, hi = num_regions;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (regions[by_id[mid]].id < regions[idx].id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  memmove(&by_id[lo + 1], &by_id[lo], (num_regions - lo) * sizeof(by_id[0]));
+  by_id[lo] = idx;
+
+  num_regions++;
+
+  first_child[idx] = next_sibling[idx] = -1;
+  while (*link >= 0) link = &next_sibling[*link];
+  *link = idx;
+}
+
+int RegionMap::findIdxById(uint16_t id) const {
+  if (index_dirty) buildIndex();
+
+  int lo = 0, hi = num_regions;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (regions[by_id[mid]].id < id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo < num_regions && regions[by_id[lo]].id == id ? by_id[lo] : -1;
+}
+
+int RegionMap::lowerBoundByName(const char* name) const {
+  if (index_dirty) buildIndex();
+
+  int lo = 0, hi = num_regions;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (strcmp(skip_hash(regions[by_name[mid]].name), name) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
 RegionEntry* RegionMap::findByName(const char* name) {
   if (strcmp(name, "*") == 0) return &wildcard;
 
   if (*name == '#') { name++; }  // ignore the '#' when matching by name
-  for (int i = 0; i < num_regions; i++) {
-    auto region = &regions[i];
-    if (strcmp(name, skip_hash(region->name)) == 0) return region;
-  }
+  int i = lowerBoundByName(name);
+  if (i < num_regions && strcmp(name, skip_hash(regions[by_name[i]].name)) == 0) return &regions[by_name[i]];
   return NULL;  // not found
 }
 
@@ -208,25 +498,24 @@ RegionEntry* RegionMap::findByNamePrefix(const char* prefix) {
   if (strcmp(prefix, "*") == 0) return &wildcard;
 
   if (*prefix == '#') { prefix++; }  // ignore the '#' when matching by name
-  RegionEntry* partial = NULL;
-  for (int i = 0; i < num_regions; i++) {
-    auto region = &regions[i];
-    if (strcmp(prefix, skip_hash(region->name)) == 0) return region;  // is a complete match, preference this one
-    if (memcmp(prefix, skip_hash(region->name), strlen(prefix)) == 0) {
-      partial = region;
-    }
+  int len = strlen(prefix);
+  int partial = -1;
+  for (int i = lowerBoundByName(prefix); i < num_regions; i++) {   // names with this prefix are all together, from here
+    int idx = by_name[i];
+    const char* name = skip_hash(regions[idx].name);
+    if (strcmp(prefix, name) == 0) return &regions[idx];  // is a complete match, preference this one
+    if (strncmp(prefix, name, len) != 0) break;
+
+    if (idx > partial) partial = idx;   // last one (in array order), as before
   }
-  return partial;
+  return partial >= 0 ? &regions[partial] : NULL;
 }
 
 RegionEntry* RegionMap::findById(uint16_t id) {
   if (id == 0) return &wildcard;   // special root Region
 
-  for (int i = 0; i < num_regions; i++) {
-    auto region = &regions[i];
-    if (region->id == id) return region;
-  }
-  return NULL;  // not found
+  int i = findIdxById(id);
+  return i >= 0 ? &regions[i] : NULL;  // NULL if not found
 }
 
 RegionEntry* RegionMap::getHomeRegion() {
@@ -240,18 +529,11 @@ void RegionMap::setHomeRegion(const RegionEntry* home) {
 bool RegionMap::removeRegion(const RegionEntry& region) {
   if (region.id == 0) return false;  // failed (cannot remove the wildcard Region)
 
-  int i;     // first check region has no child regions
-  for (i = 0; i < num_regions; i++) {
-    if (regions[i].parent == region.id) return false;   // failed (must remove child Regions first)
-  }
-
-  i = 0;
-  while (i < num_regions) {
-    if (region.id == regions[i].id) break;
-    i++;
-  }
-  if (i >= num_regions) return false;  // failed (not found)
+  int i = findIdxById(region.id);
+  if (i < 0) return false;  // failed (not found)
+  if (first_child[i] >= 0) return false;   // failed (must remove child Regions first)
 
+  invalidate();
   num_regions--;    // remove from regions array
   while (i < num_regions) {
     regions[i] = regions[i + 1];
@@ -262,6 +544,7 @@ bool RegionMap::removeRegion(const RegionEntry& region) {
 
 bool RegionMap::clear() {
   num_regions = 0;
+  invalidate();
   return true;  // success
 }
 
@@ -276,11 +559,10 @@ void RegionMap::printChildRegions(int indent, const RegionEntry* parent, Stream&
     out.printf("%s%s F\n", skip_hash(parent->name), parent->id == home_id ? "^" : "");
   }
 
-  for (int i = 0; i < num_regions; i++) {
-    auto r = &regions[i];
-    if (r->parent == parent->id) {
-      printChildRegions(indent + 1, r, out);
-    }
+  if (index_dirty) buildIndex();
+  int i = parent == &wildcard ? root_first_child : first_child[parent - regions];
+  for ( ; i >= 0; i = next_sibling[i]) {
+    printChildRegions(indent + 1, &regions[i], out);
   }
 }
 
@@ -5,9 +5,18 @@
 #include "TransportKeyStore.h"
 
 #ifndef MAX_REGION_ENTRIES
-  #define MAX_REGION_ENTRIES  32
+  #define MAX_REGION_ENTRIES  32    // NOTE: each costs ~45 bytes of RAM (entry + index)
 #endif
 
+#ifndef REGION_KEY_STATES
+  #define REGION_KEY_STATES   8     // num transport keys to keep prepared HMAC midstates for (~230 bytes each, allocated on first findMatch())
+#endif
+#ifndef REGION_MATCH_CACHE_SIZE
+  #define REGION_MATCH_CACHE_SIZE  8     // num recent packets to remember findMatch() results for
+#endif
+
+#define REGION_MATCH_WORDS  ((MAX_REGION_ENTRIES + 31) / 32)
+
 #define REGION_DENY_FLOOD   0x01
 #define REGION_DENY_DIRECT  0x02   // reserved for future
 
@@ -25,6 +34,55 @@ class RegionMap {
   RegionEntry regions[MAX_REGION_ENTRIES];
   RegionEntry wildcard;
 
+  // lookup index, rebuilt lazily (on first lookup after any change). All are indices into regions[]
+  mutable uint16_t by_name[MAX_REGION_ENTRIES];   // sorted by name (ignoring any '#')
+  mutable uint16_t by_id[MAX_REGION_ENTRIES];     // sorted by id
+  mutable int16_t first_child[MAX_REGION_ENTRIES], next_sibling[MAX_REGION_ENTRIES];   // -1 = none
+  mutable int16_t root_first_child;   // children of wildcard
+  mutable bool index_dirty;
+
+  void buildIndex() const;
+  void addToIndex(int idx);
+  int findIdxById(uint16_t id) const;
+  int lowerBoundByName(const char* name) const;
+  bool loadLegacy(File& file);
+  bool saveLegacy(FILESYSTEM* _fs);
+
+  // recent findMatch() results, per packet hash + transport code. Holds which regions' keys have been checked, and
+  // which matched (regardless of flags, so the 'mask' param, or flags changing, doesn't make them stale)
+  struct MatchResult {
+    uint8_t  hash[MAX_HASH_SIZE];
+    uint16_t code;
+    uint32_t checked[REGION_MATCH_WORDS];
+    uint32_t matched[REGION_MATCH_WORDS];
+  };
+
+  // prepared keys, per region, and recent results. Only allocated on first findMatch(), so maps which are just
+  // edited (eg. a staging copy) don't pay for it
+  struct MatchState {
+    PreparedTransportKey key_states[REGION_KEY_STATES];
+    int8_t region_keys_at[MAX_REGION_ENTRIES];     // index into key_states[], or -1 if not prepared
+    uint8_t region_num_keys[MAX_REGION_ENTRIES];
+    MatchResult recent_matches[REGION_MATCH_CACHE_SIZE];
+    int num_recent, next_recent;
+    uint16_t keys_version;
+  };
+  struct MatchStateRef {   // NOTE: not copied on assignment (each map keeps its own), just marked dirty
+    MatchState* state;
+    bool dirty;   // keys need preparing, and recent results are stale
+    MatchStateRef() : state(NULL), dirty(true) { }
+    MatchStateRef(const MatchStateRef&) : state(NULL), dirty(true) { }
+    MatchStateRef& operator=(const MatchStateRef&) { dirty = true; return *this; }
+    ~MatchStateRef() { delete state; }
+  };
+  MatchStateRef match;
+
+  void invalidateMatches() { match.dirty = true; }
+  void invalidate() { index_dirty = true; invalidateMatches(); }
+  void prepareKeys();
+  int loadRegionKeys(const RegionEntry* region, TransportKey keys[], int max_num);
+  bool regionKeyMatches(int idx, const mesh::Packet* packet);
+  MatchResult* getMatchResult(const mesh::Packet* packet);
   void printChildRegions(int indent, const RegionEntry* parent, Stream& out) const;
 
 public:
@@ -45,7 +103,7 @@ public:
   void setHomeRegion(const RegionEntry* home);
   bool removeRegion(const RegionEntry& region);
   bool clear();
-  void resetFrom(const RegionMap& src) { num_regions = 0; next_id = src.next_id; }
+  void resetFrom(const RegionMap& src) { num_regions = 0; next_id = src.next_id; invalidate(); }
   int getCount() const { return num_regions; }
   const RegionEntry* getByIdx(int i) const { return &regions[i]; }
   const RegionEntry* getRoot() const { return &wildcard; }
@@ -0,0 +1,202 @@
+#include "SimpleMeshTables.h"
+
+#define SEEN_INDEX_EMPTY   0xFFFF
+
+SeenTable::SeenTable(int key_len, int capacity) {
+  int index_size = 8;
+  while (index_size < capacity * 2) index_size <<= 1;   // keep index load <= 50%, so probes stay short
+
+  _key_len = key_len;
+  _size = capacity;
+  _head = _count = _num_live = 0;
+  _index_mask = index_size - 1;
+  _keys = new uint8_t[capacity * key_len];
+  _seen_at = new uint32_t[capacity];
+  _index = new uint16_t[index_size];
+  for (int i = 0; i < index_size; i++) _index[i] = SEEN_INDEX_EMPTY;
+}
+
+int SeenTable::homeIdx(const uint8_t* key) const {
+  uint32_t h;
+  memcpy(&h, key, 4);   // keys are already hashes (or CRCs)
+  return (h * 2654435761UL) >> 16 & _index_mask;
+}
+
+int SeenTable::findIdx(const uint8_t* key) const {
+  for (int i = homeIdx(key); _index[i] != SEEN_INDEX_EMPTY; i = (i + 1) & _index_mask) {
+    if (memcmp(keyAt(_index[i]), key, _key_len) == 0) return i;
+  }
+  return -1;
+}
+
+void SeenTable::removeIdx(int i) {
+  // backward-shift deletion, so no tombstones are needed
+  int j = i;
+  while (true) {
+    j = (j + 1) & _index_mask;
+    if (_index[j] == SEEN_INDEX_EMPTY) break;
+
+    int k = homeIdx(keyAt(_index[j]));
+    if (((j - k) & _index_mask) < ((j - i) & _index_mask)) continue;   // entry j's home is between hole and j, so must stay
+
+    _index[i] = _index[j];
+    i = j;
+  }
+  _index[i] = SEEN_INDEX_EMPTY;
+  _num_live--;
+}
+
+void SeenTable::popOldest() {
+  int i = findIdx(keyAt(_head));
+  if (i >= 0 && _index[i] == _head) removeIdx(i);   // else was already remove()'d
+  _head = (_head + 1) % _size;
+  _count--;
+}
+
+bool SeenTable::checkAndAdd(const uint8_t* key, uint32_t now, uint32_t expiry) {
+  if (expiry) {
+    while (_count > 0 && (uint32_t)(now - _seen_at[_head]) >= expiry) popOldest();   // ring is in time order
+  }
+  if (findIdx(key) >= 0) return true;
+
+  if (_count == _size) popOldest();   // full, displace oldest
+
+  int slot = (_head + _count++) % _size;
+  memcpy(&_keys[slot * _key_len], key, _key_len);
+  _seen_at[slot] = now;
+
+  int i = homeIdx(key);
+  while (_index[i] != SEEN_INDEX_EMPTY) i = (i + 1) & _index_mask;
+  _index[i] = slot;
+  _num_live++;
+  return false;
+}
+
+bool SeenTable::remove(const uint8_t* key) {
+  int i = findIdx(key);
+  if (i < 0) return false;
+  removeIdx(i);   // NOTE: its ring slot stays, until it becomes the oldest
+  return true;
+}
+
+int SeenTable::writeEntries(uint8_t* dest, int max_entries, uint32_t now) const {
+  int skip = _num_live - max_entries;   // too many, drop the oldest
+  int n = 0;
+  for (int c = 0; c < _count && n < max_entries; c++) {
+    int slot = (_head + c) % _size;
+    int i = findIdx(keyAt(slot));
+    if (i < 0 || _index[i] != slot) continue;   // was remove()'d
+    if (skip > 0) { skip--; continue; }
+
+    uint32_t age = (now - _seen_at[slot]) / 1000;
+    uint16_t age_secs = age > 0xFFFF ? 0xFFFF : age;
+    memcpy(dest, keyAt(slot), _key_len); dest += _key_len;
+    memcpy(dest, &age_secs, 2); dest += 2;
+    n++;
+  }
+  return n;
+}
+
+bool SimpleMeshTables::hasSeen(const mesh::Packet* packet) {
+  bool seen;
+  if (packet->getPayloadType() == PAYLOAD_TYPE_ACK) {
+    seen = _acks.checkAndAdd(packet->payload, now(), _ms ? _expiry : 0);   // key is the ACK crc (ACK_KEY_SIZE)
+  } else {
+    uint8_t hash[MAX_HASH_SIZE];
+    packet->calculatePacketHash(hash);
+    seen = _hashes.checkAndAdd(hash, now(), _ms ? _expiry : 0);
+  }
+
+  if (seen) {
+    if (packet->isRouteDirect()) {
+      _direct_dups++;   // keep some stats
+    } else {
+      _flood_dups++;
+    }
+  }
+  return seen;
+}
+
+void SimpleMeshTables::clear(const mesh::Packet* packet) {
+  if (packet->getPayloadType() == PAYLOAD_TYPE_ACK) {
+    _acks.remove(packet->payload);
+  } else {
+    uint8_t hash[MAX_HASH_SIZE];
+    packet->calculatePacketHash(hash);
+    _hashes.remove(hash);
+  }
+}
+
+#define SEEN_SNAPSHOT_MAGIC     0x314E4553    // "SEN1"
+#define SEEN_SNAPSHOT_HEADER    12            // {magic}{saved_at}{num hashes (2)}{num acks (2)}
+
+static uint32_t snapshotCheck(const uint8_t* data, int len) {
+  uint32_t h = 2166136261UL;   // FNV-1a
+  for (int i = 0; i < len; i++) {
+    h = (h ^ data[i]) * 16777619UL;
+  }
+  return h;
+}
+
+int SimpleMeshTables::getMaxSnapshotSize() const {
+  return SEEN_SNAPSHOT_HEADER + _hashes.getCapacity()*(MAX_HASH_SIZE + 2) + _acks.getCapacity()*(ACK_KEY_SIZE + 2) + 4;
+}
+
+int SimpleMeshTables::saveTo(uint8_t* dest, int max_len, uint32_t rtc_now) {
+  if (max_len < getMaxSnapshotSize()) return 0;
+
+  uint32_t magic = SEEN_SNAPSHOT_MAGIC;
+  uint32_t t = now();
+  uint16_t num_hashes = _hashes.writeEntries(&dest[SEEN_SNAPSHOT_HEADER], _hashes.getCapacity(), t);
+  int len = SEEN_SNAPSHOT_HEADER + num_hashes*(MAX_HASH_SIZE + 2);
+  uint16_t num_acks = _acks.writeEntries(&dest[len], _acks.getCapacity(), t);
+  len += num_acks*(ACK_KEY_SIZE + 2);
+
+  memcpy(&dest[0], &magic, 4);
+  memcpy(&dest[4], &rtc_now, 4);
+  memcpy(&dest[8], &num_hashes, 2);
+  memcpy(&dest[10], &num_acks, 2);
+  uint32_t check = snapshotCheck(dest, len);
+  memcpy(&dest[len], &check, 4); len += 4;
+  return len;
+}
+
+static void restoreEntries(SeenTable& table, const uint8_t* sp, int num, int key_len, uint32_t gap_secs, uint32_t expiry, uint32_t now) {
+  for (int i = 0; i < num; i++, sp += key_len + 2) {   // NOTE: oldest first, so ring stays in time order
+    uint16_t age_secs;
+    memcpy(&age_secs, &sp[key_len], 2);
+    uint32_t age_secs_now = age_secs + (gap_secs > 0xFFFF ? 0xFFFF : gap_secs);
+    if (expiry && age_secs_now >= expiry / 1000) continue;   // stale
+    table.checkAndAdd(sp, now - age_secs_now * 1000, 0);
+  }
+}
+
+bool SimpleMeshTables::restoreFrom(const uint8_t* src, int len, uint32_t rtc_now, bool warm_reset) {
+  if (len < SEEN_SNAPSHOT_HEADER + 4) return false;
+
+  uint32_t magic, saved_at, check;
+  uint16_t num_hashes, num_acks;
+  memcpy(&magic, &src[0], 4);
+  memcpy(&saved_at, &src[4], 4);
+  memcpy(&num_hashes, &src[8], 2);
+  memcpy(&num_acks, &src[10], 2);
+  int data_len = SEEN_SNAPSHOT_HEADER + num_hashes*(MAX_HASH_SIZE + 2) + num_acks*(ACK_KEY_SIZE + 2);
+  if (magic != SEEN_SNAPSHOT_MAGIC || data_len + 4 > len) return false;
+  memcpy(&check, &src[data_len], 4);
+  if (check != snapshotCheck(src, data_len)) return false;   // corrupt (or random RAM after power-up)
+
+  uint32_t gap_secs;
+  if (rtc_now >= saved_at) {
+    gap_secs = rtc_now - saved_at;
+  } else if (warm_reset) {
+    gap_secs = 0;   // RTC was reset, but RAM survived, so can only have been a quick restart
+  } else {
+    return false;   // unknown age, don't risk treating new packets as seen
+  }
+
+  uint32_t expiry = _ms ? _expiry : 0;
+  uint32_t t = now();
+  restoreEntries(_hashes, &src[SEEN_SNAPSHOT_HEADER], num_hashes, MAX_HASH_SIZE, gap_secs, expiry, t);
+  restoreEntries(_acks, &src[SEEN_SNAPSHOT_HEADER + num_hashes*(MAX_HASH_SIZE + 2)], num_acks, ACK_KEY_SIZE, gap_secs, expiry, t);
+  return true;
+}
@@ -2,110 +2,106 @@
 
 #include <Mesh.h>
 
-#ifdef ESP32
-  #include <FS.h>
+// defaults remember as many as the old fixed tables (~2.8KB). Low RAM variants can opt down with -D SEEN_TABLES_SMALL (~1.4KB)
+#ifdef SEEN_TABLES_SMALL
+  #define SEEN_DEFAULT_HASHES   64
+  #define SEEN_DEFAULT_ACKS     32
+#else
+  #define SEEN_DEFAULT_HASHES  128
+  #define SEEN_DEFAULT_ACKS     64
 #endif
+#ifndef MAX_PACKET_HASHES
+  #define MAX_PACKET_HASHES  SEEN_DEFAULT_HASHES     // num packets remembered (at most)
+#endif
+#ifndef MAX_PACKET_ACKS
+  #define MAX_PACKET_ACKS    SEEN_DEFAULT_ACKS
+#endif
+#define ACK_KEY_SIZE          4     // ACKs are keyed by their CRC
+
+#ifndef SEEN_EXPIRY_MILLIS
+  #define SEEN_EXPIRY_MILLIS  (10*60*1000)    // how long to remember a packet, since first seen (zero = until displaced)
+#endif
+
+/**
+ * \brief  Set of fixed length keys, with time first seen. Keys are stored in a ring buffer, in the order first seen,
+ *      with an open addressing (linear probing) hash index into the ring, so lookups are O(1). Entries expire by age,
+ *      or when the ring is full the oldest is displaced.
+*/
+class SeenTable {
+  uint8_t* _keys;        // ring buffer
+  uint32_t* _seen_at;
+  uint16_t* _index;      // ring slot, or SEEN_INDEX_EMPTY
+  int _key_len, _size, _head, _count, _index_mask, _num_live;
 
-#define MAX_PACKET_HASHES  128
-#define MAX_PACKET_ACKS     64
+  const uint8_t* keyAt(int slot) const { return &_keys[slot * _key_len]; }
+  int homeIdx(const uint8_t* key) const;
+  int findIdx(const uint8_t* key) const;
+  void removeIdx(int i);
+  void popOldest();
+
+public:
+  SeenTable(int key_len, int capacity);
+
+  /**
+   * \brief  look up 'key', and add it if not seen within 'expiry' millis
+   * \returns  true if key was already in table (and not expired)
+  */
+  bool checkAndAdd(const uint8_t* key, uint32_t now, uint32_t expiry);
+  bool remove(const uint8_t* key);
+  int count() const { return _num_live; }
+  int getCapacity() const { return _size; }
+
+  /**
+   * \brief  write the live entries, oldest first, as {key}{age secs (2 bytes)}
+   * \returns  number of entries written (newest 'max_entries', if more)
+  */
+  int writeEntries(uint8_t* dest, int max_entries, uint32_t now) const;
+};
 
 class SimpleMeshTables : public mesh::MeshTables {
-  uint8_t _hashes[MAX_PACKET_HASHES*MAX_HASH_SIZE];
-  int _next_idx;
-  uint32_t _acks[MAX_PACKET_ACKS];
-  int _next_ack_idx;
+  SeenTable _hashes, _acks;
+  mesh::MillisecondClock* _ms;
+  uint32_t _expiry;
   uint32_t _direct_dups, _flood_dups;
 
+  uint32_t now() const { return _ms ? _ms->getMillis() : 0; }   // no clock: entries are only ever displaced
+
 public:
-  SimpleMeshTables() { 
-    memset(_hashes, 0, sizeof(_hashes));
-    _next_idx = 0;
-    memset(_acks, 0, sizeof(_acks));
-    _next_ack_idx = 0;
+  SimpleMeshTables(int max_hashes=MAX_PACKET_HASHES, int max_acks=MAX_PACKET_ACKS)
+    : _hashes(MAX_HASH_SIZE, max_hashes), _acks(ACK_KEY_SIZE, max_acks), _ms(NULL), _expiry(SEEN_EXPIRY_MILLIS)
+  {
     _direct_dups = _flood_dups = 0;
   }
 
-#ifdef ESP32
-  void restoreFrom(File f) {
-    f.read(_hashes, sizeof(_hashes));
-    f.read((uint8_t *) &_next_idx, sizeof(_next_idx));
-    f.read((uint8_t *) &_acks[0], sizeof(_acks));
-    f.read((uint8_t *) &_next_ack_idx, sizeof(_next_ack_idx));
-  }
-  void saveTo(File f) {
-    f.write(_hashes, sizeof(_hashes));
-    f.write((const uint8_t *) &_next_idx, sizeof(_next_idx));
-    f.write((const uint8_t *) &_acks[0], sizeof(_acks));
-    f.write((const uint8_t *) &_next_ack_idx, sizeof(_next_ack_idx));
-  }
-#endif
-
-  bool hasSeen(const mesh::Packet* packet) override {
-    if (packet->getPayloadType() == PAYLOAD_TYPE_ACK) {
-      uint32_t ack;
-      memcpy(&ack, packet->payload, 4);
-      for (int i = 0; i < MAX_PACKET_ACKS; i++) {
-        if (ack == _acks[i]) { 
-          if (packet->isRouteDirect()) {
-            _direct_dups++;   // keep some stats
-          } else {
-            _flood_dups++;
-          }
-          return true;
-        }
-      }
-  
-      _acks[_next_ack_idx] = ack;
-      _next_ack_idx = (_next_ack_idx + 1) % MAX_PACKET_ACKS;  // cyclic table  
-      return false;
-    }
-
-    uint8_t hash[MAX_HASH_SIZE];
-    packet->calculatePacketHash(hash);
-
-    const uint8_t* sp = _hashes;
-    for (int i = 0; i < MAX_PACKET_HASHES; i++, sp += MAX_HASH_SIZE) {
-      if (memcmp(hash, sp, MAX_HASH_SIZE) == 0) { 
-        if (packet->isRouteDirect()) {
-          _direct_dups++;   // keep some stats
-        } else {
-          _flood_dups++;
-        }
-        return true;
-      }
-    }
-
-    memcpy(&_hashes[_next_idx*MAX_HASH_SIZE], hash, MAX_HASH_SIZE);
-    _next_idx = (_next_idx + 1) % MAX_PACKET_HASHES;  // cyclic table
-    return false;
-  }
+  void setClock(mesh::MillisecondClock* ms) override { _ms = ms; }
+  void setExpiry(uint32_t millis) { _expiry = millis; }
 
-  void clear(const mesh::Packet* packet) override {
-    if (packet->getPayloadType() == PAYLOAD_TYPE_ACK) {
-      uint32_t ack;
-      memcpy(&ack, packet->payload, 4);
-      for (int i = 0; i < MAX_PACKET_ACKS; i++) {
-        if (ack == _acks[i]) { 
-          _acks[i] = 0;
-          break;
-        }
-      }
-    } else {
-      uint8_t hash[MAX_HASH_SIZE];
-      packet->calculatePacketHash(hash);
-
-      uint8_t* sp = _hashes;
-      for (int i = 0; i < MAX_PACKET_HASHES; i++, sp += MAX_HASH_SIZE) {
-        if (memcmp(hash, sp, MAX_HASH_SIZE) == 0) { 
-          memset(sp, 0, MAX_HASH_SIZE);
-          break;
-        }
-      }
-    }
-  }
+  bool hasSeen(const mesh::Packet* packet) override;
+  void clear(const mesh::Packet* packet) override;
 
   uint32_t getNumDirectDups() const { return _direct_dups; }
   uint32_t getNumFloodDups() const { return _flood_dups; }
+  int getNumHashes() const { return _hashes.count(); }
 
   void resetStats() { _direct_dups = _flood_dups = 0; }
+
+  /**
+   * \returns  max length of a saveTo() snapshot
+  */
+  int getMaxSnapshotSize() const;
+
+  /**
+   * \brief  write a platform neutral snapshot of both tables (eg. to retained RAM, or a file), so can be restored after a reboot
+   * \param  rtc_now  current RTC time (secs), to timestamp the snapshot
+   * \returns  length written, or zero if 'max_len' is too small
+  */
+  int saveTo(uint8_t* dest, int max_len, uint32_t rtc_now);
+
+  /**
+   * \brief  restore entries from a saveTo() snapshot, discarding any which would now be expired. Call once, at startup
+   * \param  warm_reset  true if snapshot is from RAM retained over a reset (so gap is short), ie. can still be used if
+   *          RTC has gone backwards (eg. volatile RTC)
+   * \returns  false if snapshot is corrupt, or its age is unknown
+  */
+  bool restoreFrom(const uint8_t* src, int len, uint32_t rtc_now, bool warm_reset);
 };
@@ -0,0 +1,299 @@
+#include "SlabPacketManager.h"
+
+void ByteSlab::begin(int slot_size, int num_slots) {
+  _slab = new uint8_t[slot_size*num_slots];
+  _free_list = new uint8_t*[num_slots];
+  _slot_size = slot_size;
+  _size = _num_free = num_slots;
+  for (int i = 0; i < num_slots; i++) {
+    _free_list[i] = &_slab[(num_slots - 1 - i)*slot_size];
+  }
+#if MESH_DEBUG
+  _in_use = new uint8_t[num_slots];
+  memset(_in_use, 0, num_slots);
+#endif
+}
+
+uint8_t* ByteSlab::alloc() {
+  if (_num_free == 0) return NULL;
+
+  uint8_t* slot = _free_list[--_num_free];
+#if MESH_DEBUG
+  _in_use[(slot - _slab) / _slot_size] = 1;
+#endif
+  return slot;
+}
+
+bool ByteSlab::release(uint8_t* slot) {
+  if (_num_free >= _size) {
+    MESH_DEBUG_PRINTLN("ByteSlab::release(): ERROR: slab already full, double free?");
+    return false;
+  }
+#if MESH_DEBUG
+  if (!contains(slot) || (slot - _slab) % _slot_size != 0) {
+    MESH_DEBUG_PRINTLN("ByteSlab::release(): ERROR: slot not from this slab!");
+    return false;
+  }
+  int i = (slot - _slab) / _slot_size;
+  if (!_in_use[i]) {
+    MESH_DEBUG_PRINTLN("ByteSlab::release(): ERROR: double free, slot=%d", i);
+    return false;
+  }
+  _in_use[i] = 0;
+#endif
+  _free_list[_num_free++] = slot;
+  return true;
+}
+
+#define SLOT_HEADER_SIZE   SLAB_SLOT_HEADER_SIZE
+#define SLOT_HASH_OFFSET   3
+
+static bool isRawFlood(const uint8_t* raw) {
+  return (raw[0] & PH_ROUTE_MASK) == ROUTE_TYPE_FLOOD || (raw[0] & PH_ROUTE_MASK) == ROUTE_TYPE_TRANSPORT_FLOOD;
+}
+
+uint8_t SlabQueue::getItemHops(const void* item) const {
+  if (_working->contains(item)) return ((const mesh::Packet*)item)->getPathHashCount();
+
+  const uint8_t* raw = &((const uint8_t*)item)[SLOT_HEADER_SIZE];
+  int i = 1;   // skip header
+  if (((raw[0] & PH_ROUTE_MASK) == ROUTE_TYPE_TRANSPORT_FLOOD) || ((raw[0] & PH_ROUTE_MASK) == ROUTE_TYPE_TRANSPORT_DIRECT)) {
+    i += 4;   // skip transport codes
+  }
+  return raw[i] & 63;
+}
+
+uint8_t SlabQueue::getItemClass(const void* item) const {
+  if (_working->contains(item)) return ((const mesh::Packet*)item)->_tx_class;
+  return ((const uint8_t*)item)[2];
+}
+
+SlabPacketManager::SlabPacketManager(int num_working, int num_small, int num_medium, int num_large, uint8_t evict_policy)
+  : working(num_working),
+    send_queue(evict_policy == EVICT_POLICY_NONE || num_working + num_small + num_medium + num_large <= OUTBOUND_QUEUE_RESERVE
+                 ? num_working + num_small + num_medium + num_large
+                 : num_working + num_small + num_medium + num_large - OUTBOUND_QUEUE_RESERVE, &working),
+    rx_queue(num_working + num_small + num_medium + num_large, &working),
+    evict_policy(evict_policy)
+{
+  resetDropCounts();
+  classes[0].begin(SLOT_HEADER_SIZE + SLAB_SMALL_SLOT_SIZE, num_small);
+  classes[1].begin(SLOT_HEADER_SIZE + SLAB_MEDIUM_SLOT_SIZE, num_medium);
+  classes[2].begin(SLOT_HEADER_SIZE + SLAB_LARGE_SLOT_SIZE, num_large);
+}
+
+void* SlabPacketManager::compact(mesh::Packet* packet) {
+  int len = packet->getRawLength();
+  for (int c = 0; c < SLAB_NUM_CLASSES; c++) {
+    if (len + SLOT_HEADER_SIZE > classes[c].getSlotSize()) continue;   // too small
+
+    uint8_t* slot = classes[c].alloc();
+    if (slot) {
+      slot[0] = packet->writeTo(&slot[SLOT_HEADER_SIZE]);
+      slot[1] = (uint8_t) packet->_snr;
+      slot[2] = packet->_tx_class;
+      if (packet->isRouteFlood()) packet->calculatePacketHash(&slot[SLOT_HASH_OFFSET]);   // for findOutboundFlood()
+      working.release(packet);
+      return slot;
+    }
+    // this class is full, try next size up
+  }
+  return packet;   // no compact slots, just queue the full Packet
+}
+
+void SlabPacketManager::expand(mesh::Packet* dest, const void* item) {
+  const uint8_t* slot = (const uint8_t*) item;
+  int len = slot[0];
+  const uint8_t* raw = &slot[SLOT_HEADER_SIZE];
+
+  int i = 0;
+  dest->invalidateHash();
+  dest->header = raw[i++];
+  if (dest->hasTransportCodes()) {
+    memcpy(&dest->transport_codes[0], &raw[i], 2); i += 2;
+    memcpy(&dest->transport_codes[1], &raw[i], 2); i += 2;
+  } else {
+    dest->transport_codes[0] = dest->transport_codes[1] = 0;
+  }
+  dest->path_len = raw[i++];
+  i += mesh::Packet::writePath(dest->path, &raw[i], dest->path_len);
+  dest->payload_len = len - i;
+  memcpy(dest->payload, &raw[i], dest->payload_len);
+  dest->_snr = (int8_t) slot[1];
+  dest->_tx_class = slot[2];
+}
+
+mesh::Packet* SlabPacketManager::takeItem(void* item) {
+  if (working.contains(item)) return (mesh::Packet*) item;
+
+  mesh::Packet* packet = working.alloc();
+  if (packet) {
+    expand(packet, item);
+    releaseItem(item);
+  }
+  return packet;
+}
+
+void SlabPacketManager::releaseItem(void* item) {
+  if (working.contains(item)) {
+    working.release((mesh::Packet*) item);
+    return;
+  }
+  for (int c = 0; c < SLAB_NUM_CLASSES; c++) {
+    if (classes[c].contains(item)) {
+      classes[c].release((uint8_t*) item);
+      return;
+    }
+  }
+}
+
+mesh::Packet* SlabPacketManager::nextFrom(ScheduledQueue& queue, uint32_t now, uint8_t class_mask) {
+  void* item = queue.peekItem(now, class_mask);
+  if (item == NULL) return NULL;
+  if (!working.contains(item) && working.getFreeCount() == 0) return NULL;   // no room to expand it yet, leave queued
+
+  return takeItem(queue.getItem(now, class_mask));
+}
+
+mesh::Packet* SlabPacketManager::allocNew() {
+  mesh::Packet* packet = working.alloc();  // returns NULL if empty
+  if (packet == NULL) {
+    n_dropped[DROP_POOL_EMPTY]++;
+    MESH_DEBUG_PRINTLN("allocNew: no working packets available");
+  }
+  return packet;
+}
+
+void SlabPacketManager::free(mesh::Packet* packet) {
+  working.release(packet);
+}
+
+bool SlabPacketManager::hasRoomFor(const void* item) const {
+  if (evict_policy == EVICT_POLICY_NONE) return true;   // just the send queue's capacity
+
+  // a full Packet (no compact slot for it) must not take the working Packets kept back for Rx, and replies/ACKs
+  return !working.contains(item) || working.getFreeCount() >= OUTBOUND_QUEUE_RESERVE;
+}
+
+bool SlabPacketManager::evictFreesRoomFor(const void* victim, const mesh::Packet* packet) const {
+  if (working.contains(victim)) return true;
+  for (int c = 0; c < SLAB_NUM_CLASSES; c++) {
+    if (classes[c].contains(victim)) return packet->getRawLength() + SLOT_HEADER_SIZE <= classes[c].getSlotSize();
+  }
+  return false;
+}
+
+void SlabPacketManager::queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at, uint32_t deadline) {
+  void* item = compact(packet);
+  bool has_room = hasRoomFor(item);
+  if (has_room && send_queue.addItem(item, priority, scheduled_for, expires_at, deadline)) return;
+
+  int i = evict_policy == EVICT_POLICY_LEAST_VALUE ? send_queue.findLeastValuable(priority) : -1;
+  if (i >= 0 && !has_room && !evictFreesRoomFor(send_queue.itemAt(i), packet)) i = -1;
+  if (i >= 0) {
+    MESH_DEBUG_PRINTLN("queueOutbound: send queue full, evicting less important packet");
+    releaseItem(send_queue.removeItemByIdx(i));
+    n_dropped[DROP_TX_EVICTED]++;
+    if (!has_room) item = compact(packet);   // (packet is item) evicted one freed a working Packet, or a compact slot it fits
+    send_queue.addItem(item, priority, scheduled_for, expires_at, deadline);
+  } else {
+    MESH_DEBUG_PRINTLN("queueOutbound: send queue full, dropping packet");
+    n_dropped[DROP_TX_QUEUE_FULL]++;
+    releaseItem(item);
+  }
+}
+
+void SlabPacketManager::purgeExpired(uint32_t now) {
+  int i;
+  while ((i = send_queue.findExpired(now)) >= 0) {
+    releaseItem(send_queue.removeItemByIdx(i));
+    n_dropped[DROP_TX_EXPIRED]++;
+  }
+}
+
+mesh::Packet* SlabPacketManager::getNextOutbound(uint32_t now, uint8_t class_mask) {
+  purgeExpired(now);
+  return nextFrom(send_queue, now, class_mask);
+}
+
+int SlabPacketManager::findOutboundAtRisk(uint32_t now, uint32_t busy_millis, uint8_t class_mask) {
+  purgeExpired(now);   // an expired packet must not be picked (and sent) ahead of the others
+  return send_queue.findAtRisk(now, busy_millis, class_mask);
+}
+
+int SlabPacketManager::getOutboundCount(uint32_t now) const {
+  return send_queue.countBefore(now);
+}
+
+int SlabPacketManager::getOutboundTotal() const {
+  return send_queue.count();
+}
+
+int SlabPacketManager::getFreeCount() const {
+  return working.getFreeCount();
+}
+
+int SlabPacketManager::getMaxUsedCount() const {
+  return working.getMaxUsed();
+}
+
+mesh::Packet* SlabPacketManager::getOutboundByIdx(int i) {
+  void* item = send_queue.itemAt(i);
+  if (item == NULL || working.contains(item)) return (mesh::Packet*) item;
+
+  expand(&peek_pkt, item);   // NOTE: just a copy, only valid until next call
+  return &peek_pkt;
+}
+
+int SlabPacketManager::findOutboundFlood(const uint8_t* hash) const {
+  uint8_t h[MAX_HASH_SIZE];
+  for (int i = 0; i < send_queue.count(); i++) {
+    const void* item = send_queue.itemAt(i);
+    if (working.contains(item)) {
+      auto packet = (const mesh::Packet*) item;
+      if (!packet->isRouteFlood()) continue;
+      packet->calculatePacketHash(h);
+      if (memcmp(h, hash, MAX_HASH_SIZE) == 0) return i;
+    } else {
+      auto slot = (const uint8_t*) item;
+      if (isRawFlood(&slot[SLOT_HEADER_SIZE]) && memcmp(&slot[SLOT_HASH_OFFSET], hash, MAX_HASH_SIZE) == 0) return i;
+    }
+  }
+  return -1;
+}
+
+mesh::Packet* SlabPacketManager::removeOutboundByIdx(int i) {
+  void* item = send_queue.itemAt(i);
+  if (item == NULL) return NULL;
+  if (!working.contains(item) && working.getFreeCount() == 0) return NULL;   // no room to expand it
+
+  return takeItem(send_queue.removeItemByIdx(i));
+}
+
+bool SlabPacketManager::onOutboundHeard(int i, uint8_t threshold) {
+  if (send_queue.incHeardCount(i) < threshold) return false;
+
+  releaseItem(send_queue.removeItemByIdx(i));
+  n_dropped[DROP_TX_SUPPRESSED]++;
+  return true;
+}
+
+void SlabPacketManager::queueInbound(mesh::Packet* packet, uint32_t scheduled_for) {
+  void* item = compact(packet);
+  if (!rx_queue.addItem(item, 0, scheduled_for)) {
+    MESH_DEBUG_PRINTLN("queueInbound: rx queue full, dropping packet");
+    n_dropped[DROP_RX_QUEUE_FULL]++;
+    releaseItem(item);
+  }
+}
+
+mesh::Packet* SlabPacketManager::getNextInbound(uint32_t now) {
+  return nextFrom(rx_queue, now, TX_CLASS_MASK_ALL);
+}
+
+bool SlabPacketManager::getNextOutboundTime(uint32_t& when) const {
+  return send_queue.earliestScheduled(when);
+}
+bool SlabPacketManager::getNextInboundTime(uint32_t& when) const {
+  return rx_queue.earliestScheduled(when);
+}
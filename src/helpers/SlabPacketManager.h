@@ -0,0 +1,103 @@
+#pragma once
+
+#include "StaticPoolPacketManager.h"
+
+// slot capacities (in raw/wire bytes) of the compact size classes
+#ifndef SLAB_SMALL_SLOT_SIZE
+  #define SLAB_SMALL_SLOT_SIZE    32     // eg. ACK, multipart ACK, control, short trace
+#endif
+#ifndef SLAB_MEDIUM_SLOT_SIZE
+  #define SLAB_MEDIUM_SLOT_SIZE   96     // eg. short txt msgs, path returns
+#endif
+#define SLAB_LARGE_SLOT_SIZE     (MAX_TRANS_UNIT - 1)     // anything (max length of Packet::writeTo())
+
+#define SLAB_NUM_CLASSES   3
+
+// compact slot layout:  {raw-len}{snr}{tx-class}{packet-hash, if flood}{raw bytes, as per Packet::writeTo()}
+#define SLAB_SLOT_HEADER_SIZE   (3 + MAX_HASH_SIZE)
+
+/**
+ * \brief  Fixed number of equal sized byte slots, allocated as a single slab.
+*/
+class ByteSlab {
+  uint8_t* _slab;
+  uint8_t** _free_list;
+  int _slot_size, _size, _num_free;
+#if MESH_DEBUG
+  uint8_t* _in_use;   // for double-free detection
+#endif
+
+public:
+  ByteSlab() : _slab(NULL), _free_list(NULL), _slot_size(0), _size(0), _num_free(0) { }
+  void begin(int slot_size, int num_slots);
+  uint8_t* alloc();
+  bool release(uint8_t* slot);   // returns false if slot is foreign, or already free
+  bool contains(const void* ptr) const { return ptr >= (const void*)_slab && ptr < (const void*)(_slab + _slot_size*_size); }
+  int getSlotSize() const { return _slot_size; }
+  int getFreeCount() const { return _num_free; }
+};
+
+/**
+ * \brief  ScheduledQueue of items which are either full Packets (from 'working' pool), or compact slots.
+*/
+class SlabQueue : public ScheduledQueue {
+  const PacketPool* _working;
+
+protected:
+  uint8_t getItemHops(const void* item) const override;
+  uint8_t getItemClass(const void* item) const override;
+
+public:
+  SlabQueue(int max_entries, const PacketPool* working) : ScheduledQueue(max_entries), _working(working) { }
+};
+
+/**
+ * \brief  A PacketManager which keeps only a few full-sized 'working' Packets. While Packets are waiting
+ *      in the outbound/inbound queues they are stored in their compact wire format, in the smallest
+ *      of several slot size-classes that fits. Packets are re-expanded to a full Packet when de-queued,
+ *      so are free to grow again. (during flood bursts, most packets in RAM are just sitting in queues)
+*/
+class SlabPacketManager : public mesh::PacketManager {
+  PacketPool working;
+  ByteSlab classes[SLAB_NUM_CLASSES];   // smallest first
+  SlabQueue send_queue, rx_queue;
+  mesh::Packet peek_pkt;   // for getOutboundByIdx()
+  uint8_t evict_policy;
+  uint32_t n_dropped[NUM_DROP_REASONS];
+
+  void* compact(mesh::Packet* packet);
+  void expand(mesh::Packet* dest, const void* item);
+  mesh::Packet* takeItem(void* item);
+  void releaseItem(void* item);
+  bool hasRoomFor(const void* item) const;
+  bool evictFreesRoomFor(const void* victim, const mesh::Packet* packet) const;
+  void purgeExpired(uint32_t now);
+  mesh::Packet* nextFrom(ScheduledQueue& queue, uint32_t now, uint8_t class_mask);
+
+public:
+  /**
+   * \param  num_working   number of full-sized Packets (for Rx, Tx and the packet being processed)
+   * \param  num_small, num_medium, num_large   number of compact slots in each size-class
+  */
+  SlabPacketManager(int num_working, int num_small, int num_medium, int num_large, uint8_t evict_policy=OUTBOUND_EVICT_POLICY);
+
+  mesh::Packet* allocNew() override;
+  void free(mesh::Packet* packet) override;
+  void queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at, uint32_t deadline) override;
+  mesh::Packet* getNextOutbound(uint32_t now, uint8_t class_mask) override;
+  int getOutboundCount(uint32_t now) const override;
+  int getOutboundTotal() const override;
+  int getFreeCount() const override;
+  int getMaxUsedCount() const override;
+  mesh::Packet* getOutboundByIdx(int i) override;
+  mesh::Packet* removeOutboundByIdx(int i) override;
+  int findOutboundFlood(const uint8_t* hash) const override;
+  bool onOutboundHeard(int i, uint8_t threshold) override;
+  int findOutboundAtRisk(uint32_t now, uint32_t busy_millis, uint8_t class_mask) override;
+  void queueInbound(mesh::Packet* packet, uint32_t scheduled_for) override;
+  mesh::Packet* getNextInbound(uint32_t now) override;
+  bool getNextOutboundTime(uint32_t& when) const override;
+  bool getNextInboundTime(uint32_t& when) const override;
+  uint32_t getNumDropped(int reason) const override { return n_dropped[reason]; }
+  void resetDropCounts() override { memset(n_dropped, 0, sizeof(n_dropped)); }
+};
@@ -1,98 +1,325 @@
 #include "StaticPoolPacketManager.h"
 
-PacketQueue::PacketQueue(int max_entries) {
-  _table = new mesh::Packet*[max_entries];
-  _pri_table = new uint8_t[max_entries];
-  _schedule_table = new uint32_t[max_entries];
+ScheduledQueue::ScheduledQueue(int max_entries) {
+  _table = new Entry[max_entries];
   _size = max_entries;
-  _num = 0;
+  _num_ready = _num_waiting = 0;
+  _num_expiring = _num_deadlines = 0;
+  _next_expiry = 0;
+  _next_seq = 0;
 }
 
-int PacketQueue::countBefore(uint32_t now) const {
-  if (now == 0xFFFFFFFF) return _num;  // sentinel: count all entries regardless of schedule
-
-  int n = 0;
-  for (int j = 0; j < _num; j++) {
-    if ((int32_t)(_schedule_table[j] - now) > 0) continue;   // scheduled for future... ignore for now
-    n++;
+bool ScheduledQueue::isBefore(bool ready, const Entry& a, const Entry& b) const {
+  if (ready) {
+    if (a.priority != b.priority) return a.priority < b.priority;
+  } else {
+    if (a.scheduled_for != b.scheduled_for) return (int32_t)(a.scheduled_for - b.scheduled_for) < 0;
   }
-  return n;
+  return (int16_t)(a.seq - b.seq) < 0;
 }
 
-mesh::Packet* PacketQueue::get(uint32_t now) {
-  uint8_t min_pri = 0xFF;
-  int best_idx = -1;
-  for (int j = 0; j < _num; j++) {
-    if ((int32_t)(_schedule_table[j] - now) > 0) continue;   // scheduled for future... ignore for now
-    if (_pri_table[j] < min_pri) {  // select most important priority amongst non-future entries
-      min_pri = _pri_table[j];
-      best_idx = j;
-    }
+void ScheduledQueue::siftUp(bool ready, int k) {
+  Entry e = at(ready, k);
+  while (k > 0) {
+    int parent = (k - 1) / 2;
+    if (!isBefore(ready, e, at(ready, parent))) break;
+    at(ready, k) = at(ready, parent);
+    k = parent;
   }
-  if (best_idx < 0) return NULL;   // empty, or all items are still in the future
+  at(ready, k) = e;
+}
 
-  mesh::Packet* top = _table[best_idx];
-  int i = best_idx;
-  _num--;
-  while (i < _num) {
-    _table[i] = _table[i+1];
-    _pri_table[i] = _pri_table[i+1];
-    _schedule_table[i] = _schedule_table[i+1];
-    i++;
+void ScheduledQueue::siftDown(bool ready, int k) {
+  int n = ready ? _num_ready : _num_waiting;
+  Entry e = at(ready, k);
+  while (true) {
+    int child = 2*k + 1;
+    if (child >= n) break;
+    if (child + 1 < n && isBefore(ready, at(ready, child + 1), at(ready, child))) child++;
+    if (!isBefore(ready, at(ready, child), e)) break;
+    at(ready, k) = at(ready, child);
+    k = child;
   }
-  return top;
+  at(ready, k) = e;
 }
 
-mesh::Packet* PacketQueue::removeByIdx(int i) {
-  if (i >= _num) return NULL;  // invalid index
+void ScheduledQueue::push(bool ready, const Entry& e) {
+  int k = ready ? _num_ready++ : _num_waiting++;
+  at(ready, k) = e;
+  siftUp(ready, k);
+}
 
-  mesh::Packet* item = _table[i];
-  _num--;
-  while (i < _num) {
-    _table[i] = _table[i+1];
-    _pri_table[i] = _pri_table[i+1];
-    _schedule_table[i] = _schedule_table[i+1];
-    i++;
+ScheduledQueue::Entry ScheduledQueue::removeAt(bool ready, int k) {
+  Entry item = at(ready, k);
+  int last = ready ? --_num_ready : --_num_waiting;
+  if (k < last) {
+    at(ready, k) = at(ready, last);
+    siftDown(ready, k);
+    siftUp(ready, k);
   }
   return item;
 }
 
-bool PacketQueue::add(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for) {
-  if (_num == _size) {
+void* ScheduledQueue::takeAt(bool ready, int k) {
+  Entry e = removeAt(ready, k);
+  if (e.expires_at) _num_expiring--;
+  if (e.deadline) _num_deadlines--;
+  return e.item;
+}
+
+void ScheduledQueue::promoteReady(uint32_t now) {
+  while (_num_waiting > 0 && (int32_t)(at(false, 0).scheduled_for - now) <= 0) {
+    push(true, removeAt(false, 0));
+  }
+}
+
+int ScheduledQueue::countWaitingBefore(int k, uint32_t now) const {
+  // heap property: if this entry is in the future, so is its entire sub-tree
+  if (k >= _num_waiting || (int32_t)(at(false, k).scheduled_for - now) > 0) return 0;
+  return 1 + countWaitingBefore(2*k + 1, now) + countWaitingBefore(2*k + 2, now);
+}
+
+int ScheduledQueue::countBefore(uint32_t now) const {
+  if (now == 0xFFFFFFFF) return count();  // sentinel: count all entries regardless of schedule
+
+  return _num_ready + countWaitingBefore(0, now);
+}
+
+bool ScheduledQueue::earliestScheduled(uint32_t& when) const {
+  if (_num_ready > 0) {
+    when = at(true, 0).scheduled_for;   // already due, (all waiting entries are later)
+    return true;
+  }
+  if (_num_waiting > 0) {
+    when = at(false, 0).scheduled_for;
+    return true;
+  }
+  return false;
+}
+
+int ScheduledQueue::findBestReady(uint8_t class_mask) const {
+  if (_num_ready == 0) return -1;   // empty, or all items are still in the future
+  if (class_mask == TX_CLASS_MASK_ALL) return 0;   // top of heap
+  if (class_mask & (1 << getItemClass(at(true, 0).item))) return 0;   // top of heap is allowed, so is the best
+
+  int best = -1;
+  for (int i = 0; i < _num_ready; i++) {
+    if ((class_mask & (1 << getItemClass(at(true, i).item))) == 0) continue;
+    if (best < 0 || isBefore(true, at(true, i), at(true, best))) best = i;
+  }
+  return best;
+}
+
+void* ScheduledQueue::peekItem(uint32_t now, uint8_t class_mask) {
+  promoteReady(now);
+  int i = findBestReady(class_mask);
+  return i < 0 ? NULL : at(true, i).item;
+}
+
+void* ScheduledQueue::getItem(uint32_t now, uint8_t class_mask) {
+  promoteReady(now);
+  int i = findBestReady(class_mask);
+  return i < 0 ? NULL : takeAt(true, i);   // most important priority amongst non-future entries
+}
+
+void* ScheduledQueue::itemAt(int i) const {
+  if (i < _num_ready) return at(true, i).item;
+  i -= _num_ready;
+  if (i < _num_waiting) return at(false, i).item;
+  return NULL;  // invalid index
+}
+
+void* ScheduledQueue::removeItemByIdx(int i) {
+  if (i < _num_ready) return takeAt(true, i);
+  i -= _num_ready;
+  if (i < _num_waiting) return takeAt(false, i);
+  return NULL;  // invalid index
+}
+
+int ScheduledQueue::incHeardCount(int i) {
+  if (i < 0 || i >= count()) return 0;  // invalid index
+
+  Entry& e = i < _num_ready ? at(true, i) : at(false, i - _num_ready);
+  if (e.heard < 255) e.heard++;
+  return e.heard;
+}
+
+bool ScheduledQueue::addItem(void* item, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at, uint32_t deadline) {
+  if (count() == _size) {
     return false;
   }
-  _table[_num] = packet;
-  _pri_table[_num] = priority;
-  _schedule_table[_num] = scheduled_for;
-  _num++;
+  Entry e;
+  e.item = item;
+  e.scheduled_for = scheduled_for;
+  e.expires_at = expires_at;
+  e.deadline = deadline;
+  e.seq = _next_seq++;
+  e.priority = priority;
+  e.heard = 0;
+  if (expires_at) {
+    if (_num_expiring == 0 || (int32_t)(expires_at - _next_expiry) < 0) _next_expiry = expires_at;
+    _num_expiring++;
+  }
+  if (deadline) _num_deadlines++;
+  push(false, e);   // promoted to 'ready' on next get()
   return true;
 }
 
-StaticPoolPacketManager::StaticPoolPacketManager(int pool_size): unused(pool_size), send_queue(pool_size), rx_queue(pool_size) {
-  // load up our unusued Packet pool
+int ScheduledQueue::findLeastValuable(uint8_t priority) const {
+  int best = -1;
+  uint8_t best_hops = 0;
+  for (int i = 0; i < count(); i++) {
+    const Entry& e = i < _num_ready ? at(true, i) : at(false, i - _num_ready);
+    if (e.priority <= priority) continue;   // not less important than new one
+
+    uint8_t hops = getItemHops(e.item);
+    if (best >= 0) {
+      const Entry& b = best < _num_ready ? at(true, best) : at(false, best - _num_ready);
+      if (e.priority < b.priority) continue;
+      if (e.priority == b.priority) {
+        if (hops < best_hops) continue;
+        if (hops == best_hops && (int16_t)(e.seq - b.seq) > 0) continue;   // newer
+      }
+    }
+    best = i;
+    best_hops = hops;
+  }
+  return best;
+}
+
+int ScheduledQueue::findExpired(uint32_t now) const {
+  if (_num_expiring == 0 || (int32_t)(now - _next_expiry) <= 0) return -1;   // nothing can have expired yet
+
+  uint32_t earliest = 0;
+  bool found = false;
+  for (int i = 0; i < count(); i++) {
+    const Entry& e = i < _num_ready ? at(true, i) : at(false, i - _num_ready);
+    if (e.expires_at == 0) continue;
+    if ((int32_t)(now - e.expires_at) > 0) return i;
+    if (!found || (int32_t)(e.expires_at - earliest) < 0) earliest = e.expires_at;
+    found = true;
+  }
+  _next_expiry = earliest;   // none expired, so the scan can be skipped until then
+  return -1;
+}
+
+int ScheduledQueue::findAtRisk(uint32_t now, uint32_t busy_millis, uint8_t class_mask) {
+  if (_num_deadlines == 0) return -1;   // common case, no scan needed
+  promoteReady(now);
+
+  int best = -1;
+  for (int i = 0; i < _num_ready; i++) {   // NOTE: ready entries are first in itemAt() order
+    const Entry& e = at(true, i);
+    if (e.deadline == 0 || (class_mask & (1 << getItemClass(e.item))) == 0) continue;
+    if (e.expires_at && (int32_t)(now - e.expires_at) > 0) continue;   // stale, will be purged
+
+    int32_t slack = (int32_t)(e.deadline - now);
+    if (slack < 0 || slack >= (int32_t)busy_millis) continue;   // already missed, or not at risk (yet)
+    if (best < 0 || (int32_t)(e.deadline - at(true, best).deadline) < 0) best = i;
+  }
+  return best;
+}
+
+PacketPool::PacketPool(int pool_size) {
+  _slab = new mesh::Packet[pool_size];
+  _free_list = new mesh::Packet*[pool_size];
+  _size = _num_free = pool_size;
+  _max_used = 0;
   for (int i = 0; i < pool_size; i++) {
-    unused.add(new mesh::Packet(), 0, 0);
+    _free_list[i] = &_slab[pool_size - 1 - i];   // so first alloc() is _slab[0]
+  }
+#if MESH_DEBUG
+  _in_use = new uint8_t[pool_size];
+  memset(_in_use, 0, pool_size);
+#endif
+}
+
+mesh::Packet* PacketPool::alloc() {
+  if (_num_free == 0) return NULL;   // pool exhausted
+
+  mesh::Packet* packet = _free_list[--_num_free];
+  int used = _size - _num_free;
+  if (used > _max_used) _max_used = used;
+#if MESH_DEBUG
+  _in_use[packet - _slab] = 1;
+#endif
+  return packet;
+}
+
+bool PacketPool::release(mesh::Packet* packet) {
+  if (_num_free >= _size) {
+    MESH_DEBUG_PRINTLN("PacketPool::release(): ERROR: pool already full, double free?");
+    return false;
   }
+#if MESH_DEBUG
+  if (packet < _slab || packet >= _slab + _size) {
+    MESH_DEBUG_PRINTLN("PacketPool::release(): ERROR: packet not from this pool!");
+    return false;
+  }
+  if (!_in_use[packet - _slab]) {
+    MESH_DEBUG_PRINTLN("PacketPool::release(): ERROR: double free, slot=%d", (int)(packet - _slab));
+    return false;
+  }
+  _in_use[packet - _slab] = 0;
+#endif
+  _free_list[_num_free++] = packet;
+  return true;
+}
+
+StaticPoolPacketManager::StaticPoolPacketManager(int pool_size, uint8_t evict_policy)
+  : pool(pool_size),
+    send_queue(evict_policy == EVICT_POLICY_NONE || pool_size <= OUTBOUND_QUEUE_RESERVE ? pool_size : pool_size - OUTBOUND_QUEUE_RESERVE),
+    rx_queue(pool_size), evict_policy(evict_policy)
+{
+  resetDropCounts();
 }
 
 mesh::Packet* StaticPoolPacketManager::allocNew() {
-  return unused.removeByIdx(0);  // just get first one (returns NULL if empty)
+  mesh::Packet* packet = pool.alloc();  // returns NULL if empty
+  if (packet == NULL) {
+    n_dropped[DROP_POOL_EMPTY]++;
+    // any packets not in a queue are held by Dispatcher/sub-classes (usually just one or two), otherwise a leak
+    MESH_DEBUG_PRINTLN("allocNew: pool exhausted, %d packets held outside of queues", pool.getSize() - send_queue.count() - rx_queue.count());
+  }
+  return packet;
 }
 
 void StaticPoolPacketManager::free(mesh::Packet* packet) {
-  unused.add(packet, 0, 0);
+  pool.release(packet);
 }
 
-void StaticPoolPacketManager::queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for) {
-  if (!send_queue.add(packet, priority, scheduled_for)) {
+void StaticPoolPacketManager::queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at, uint32_t deadline) {
+  if (send_queue.add(packet, priority, scheduled_for, expires_at, deadline)) return;
+
+  int i = evict_policy == EVICT_POLICY_LEAST_VALUE ? send_queue.findLeastValuable(priority) : -1;
+  if (i >= 0) {
+    MESH_DEBUG_PRINTLN("queueOutbound: send queue full, evicting less important packet");
+    free(send_queue.removeByIdx(i));
+    n_dropped[DROP_TX_EVICTED]++;
+    send_queue.add(packet, priority, scheduled_for, expires_at, deadline);
+  } else {
     MESH_DEBUG_PRINTLN("queueOutbound: send queue full, dropping packet");
+    n_dropped[DROP_TX_QUEUE_FULL]++;
     free(packet);
   }
 }
 
-mesh::Packet* StaticPoolPacketManager::getNextOutbound(uint32_t now) {
-  //send_queue.sort();   // sort by scheduled_for/priority first
-  return send_queue.get(now);
+void StaticPoolPacketManager::purgeExpired(uint32_t now) {
+  int i;
+  while ((i = send_queue.findExpired(now)) >= 0) {
+    free(send_queue.removeByIdx(i));
+    n_dropped[DROP_TX_EXPIRED]++;
+  }
+}
+
+mesh::Packet* StaticPoolPacketManager::getNextOutbound(uint32_t now, uint8_t class_mask) {
+  purgeExpired(now);   // don't spend airtime on stale packets (also frees their pool slots)
+  return send_queue.get(now, class_mask);
+}
+
+int StaticPoolPacketManager::findOutboundAtRisk(uint32_t now, uint32_t busy_millis, uint8_t class_mask) {
+  purgeExpired(now);   // an expired packet must not be picked (and sent) ahead of the others
+  return send_queue.findAtRisk(now, busy_millis, class_mask);
 }
 
 int  StaticPoolPacketManager::getOutboundCount(uint32_t now) const {
@@ -104,7 +331,11 @@ int  StaticPoolPacketManager::getOutboundTotal() const {
 }
 
 int StaticPoolPacketManager::getFreeCount() const {
-  return unused.count();
+  return pool.getFreeCount();
+}
+
+int StaticPoolPacketManager::getMaxUsedCount() const {
+  return pool.getMaxUsed();
 }
 
 mesh::Packet* StaticPoolPacketManager::getOutboundByIdx(int i) {
@@ -113,13 +344,38 @@ mesh::Packet* StaticPoolPacketManager::getOutboundByIdx(int i) {
 mesh::Packet* StaticPoolPacketManager::removeOutboundByIdx(int i) {
   return send_queue.removeByIdx(i);
 }
+int StaticPoolPacketManager::findOutboundFlood(const uint8_t* hash) const {
+  uint8_t h[MAX_HASH_SIZE];
+  for (int i = 0; i < send_queue.count(); i++) {
+    const mesh::Packet* packet = send_queue.itemAt(i);
+    if (!packet->isRouteFlood()) continue;
+    packet->calculatePacketHash(h);   // cached in packet, usually from hasSeen() when received
+    if (memcmp(h, hash, MAX_HASH_SIZE) == 0) return i;
+  }
+  return -1;
+}
+bool StaticPoolPacketManager::onOutboundHeard(int i, uint8_t threshold) {
+  if (send_queue.incHeardCount(i) < threshold) return false;
+
+  free(send_queue.removeByIdx(i));
+  n_dropped[DROP_TX_SUPPRESSED]++;
+  return true;
+}
 
 void StaticPoolPacketManager::queueInbound(mesh::Packet* packet, uint32_t scheduled_for) {
   if (!rx_queue.add(packet, 0, scheduled_for)) {
     MESH_DEBUG_PRINTLN("queueInbound: rx queue full, dropping packet");
+    n_dropped[DROP_RX_QUEUE_FULL]++;
     free(packet);
   }
 }
 mesh::Packet* StaticPoolPacketManager::getNextInbound(uint32_t now) {
   return rx_queue.get(now);
 }
+
+bool StaticPoolPacketManager::getNextOutboundTime(uint32_t& when) const {
+  return send_queue.earliestScheduled(when);
+}
+bool StaticPoolPacketManager::getNextInboundTime(uint32_t& when) const {
+  return rx_queue.earliestScheduled(when);
+}
@@ -2,37 +2,150 @@
 
 #include <Dispatcher.h>
 
-class PacketQueue {
-  mesh::Packet** _table;
-  uint8_t* _pri_table;
-  uint32_t* _schedule_table;
-  int _size, _num;
+/**
+ * \brief  Priority queue of scheduled items, using two binary heaps sharing the one table:
+ *      'ready' entries (grows up from start, ordered by priority then insertion order), and
+ *      'waiting' entries (grows down from end, ordered by scheduled_for).
+ *      Waiting entries are moved to the ready heap once their scheduled time has passed.
+*/
+class ScheduledQueue {
+  struct Entry {
+    void* item;
+    uint32_t scheduled_for;
+    uint32_t expires_at;   // zero = never
+    uint32_t deadline;     // zero = none
+    uint16_t seq;      // insertion order, so equal priorities are FIFO
+    uint8_t priority;
+    uint8_t heard;     // num times heard from neighbours, while queued
+  };
+  Entry* _table;
+  int _size, _num_ready, _num_waiting;
+  int _num_expiring, _num_deadlines;   // entries with non-zero expires_at / deadline
+  mutable uint32_t _next_expiry;   // lower bound on earliest expires_at (exact after a findExpired() scan)
+  uint16_t _next_seq;
+
+  Entry& at(bool ready, int k) const { return ready ? _table[k] : _table[_size - 1 - k]; }
+  bool isBefore(bool ready, const Entry& a, const Entry& b) const;
+  void siftUp(bool ready, int k);
+  void siftDown(bool ready, int k);
+  void push(bool ready, const Entry& e);
+  Entry removeAt(bool ready, int k);
+  void* takeAt(bool ready, int k);
+  void promoteReady(uint32_t now);
+  int countWaitingBefore(int k, uint32_t now) const;
+  int findBestReady(uint8_t class_mask) const;   // O(1), unless the top entry's class is masked out
+
+protected:
+  virtual uint8_t getItemHops(const void* item) const { return 0; }
+  virtual uint8_t getItemClass(const void* item) const { return 0; }   // one of TX_CLASS_ values
 
 public:
-  PacketQueue(int max_entries);
-  mesh::Packet* get(uint32_t now);
-  bool add(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for);
-  int count() const { return _num; }
+  ScheduledQueue(int max_entries);
+  void* peekItem(uint32_t now, uint8_t class_mask=TX_CLASS_MASK_ALL);     // next get() result, without removing
+  void* getItem(uint32_t now, uint8_t class_mask=TX_CLASS_MASK_ALL);
+  bool addItem(void* item, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at=0, uint32_t deadline=0);
+  int count() const { return _num_ready + _num_waiting; }
+  int getCapacity() const { return _size; }
   int countBefore(uint32_t now) const;
-  mesh::Packet* itemAt(int i) const { return _table[i]; }
-  mesh::Packet* removeByIdx(int i);
+  bool earliestScheduled(uint32_t& when) const;
+  void* itemAt(int i) const;
+  void* removeItemByIdx(int i);
+  int incHeardCount(int i);   // returns new count
+
+  /**
+   * \brief  find the least valuable entry which is less important than 'priority', ie. highest priority number,
+   *       then farthest hop count, then oldest.
+   * \returns  index (as per itemAt()), or -1 if no such entry
+  */
+  int findLeastValuable(uint8_t priority) const;
+
+  /**
+   * \returns  index (as per itemAt()) of an entry whose 'expires_at' time has passed, or -1 if none
+  */
+  int findExpired(uint32_t now) const;
+
+  /**
+   * \returns  index (as per itemAt()) of the due entry with earliest deadline, which would miss it if 'busy_millis' passed
+   *        first, or -1 if none
+  */
+  int findAtRisk(uint32_t now, uint32_t busy_millis, uint8_t class_mask=TX_CLASS_MASK_ALL);
+};
+
+class PacketQueue : public ScheduledQueue {
+protected:
+  uint8_t getItemHops(const void* item) const override { return ((const mesh::Packet*)item)->getPathHashCount(); }
+  uint8_t getItemClass(const void* item) const override { return ((const mesh::Packet*)item)->_tx_class; }
+
+public:
+  PacketQueue(int max_entries) : ScheduledQueue(max_entries) { }
+  mesh::Packet* get(uint32_t now, uint8_t class_mask=TX_CLASS_MASK_ALL) { return (mesh::Packet*) getItem(now, class_mask); }
+  bool add(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at=0, uint32_t deadline=0) {
+    return addItem(packet, priority, scheduled_for, expires_at, deadline);
+  }
+  mesh::Packet* itemAt(int i) const { return (mesh::Packet*) ScheduledQueue::itemAt(i); }
+  mesh::Packet* removeByIdx(int i) { return (mesh::Packet*) removeItemByIdx(i); }
+};
+
+/**
+ * \brief  Fixed pool of Packets, allocated once as a single contiguous slab, with a LIFO stack of free slots.
+ *      alloc() and release() are both O(1).
+*/
+class PacketPool {
+  mesh::Packet* _slab;
+  mesh::Packet** _free_list;
+  int _size, _num_free, _max_used;
+#if MESH_DEBUG
+  uint8_t* _in_use;   // for double-free detection
+#endif
+
+public:
+  PacketPool(int pool_size);
+  mesh::Packet* alloc();
+  bool release(mesh::Packet* packet);   // returns false if packet is foreign, or already free
+  bool contains(const void* ptr) const { return ptr >= (const void*)_slab && ptr < (const void*)(_slab + _size); }
+  int getSize() const { return _size; }
+  int getFreeCount() const { return _num_free; }
+  int getMaxUsed() const { return _max_used; }   // high-water mark
 };
 
+#define EVICT_POLICY_NONE          0   // send queue full: drop the new packet
+#define EVICT_POLICY_LEAST_VALUE   1   // send queue full: new packet displaces a less important one (see findLeastValuable())
+
+#ifndef OUTBOUND_EVICT_POLICY
+  #define OUTBOUND_EVICT_POLICY    EVICT_POLICY_LEAST_VALUE
+#endif
+#ifndef OUTBOUND_QUEUE_RESERVE
+  #define OUTBOUND_QUEUE_RESERVE   2   // pool packets kept back from send queue (for Rx, and replies/ACKs), when evicting
+#endif
+
 class StaticPoolPacketManager : public mesh::PacketManager {
-  PacketQueue unused, send_queue, rx_queue;
+  PacketPool pool;
+  PacketQueue send_queue, rx_queue;
+  uint8_t evict_policy;
+  uint32_t n_dropped[NUM_DROP_REASONS];
+
+  void purgeExpired(uint32_t now);
 
 public:
-  StaticPoolPacketManager(int pool_size);
+  StaticPoolPacketManager(int pool_size, uint8_t evict_policy=OUTBOUND_EVICT_POLICY);
 
   mesh::Packet* allocNew() override;
   void free(mesh::Packet* packet) override;
-  void queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for) override;
-  mesh::Packet* getNextOutbound(uint32_t now) override;
+  void queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for, uint32_t expires_at, uint32_t deadline) override;
+  mesh::Packet* getNextOutbound(uint32_t now, uint8_t class_mask) override;
   int getOutboundCount(uint32_t now) const override;
   int getOutboundTotal() const override;
   int getFreeCount() const override;
+  int getMaxUsedCount() const override;
   mesh::Packet* getOutboundByIdx(int i) override;
   mesh::Packet* removeOutboundByIdx(int i) override;
+  int findOutboundFlood(const uint8_t* hash) const override;
+  bool onOutboundHeard(int i, uint8_t threshold) override;
+  int findOutboundAtRisk(uint32_t now, uint32_t busy_millis, uint8_t class_mask) override;
   void queueInbound(mesh::Packet* packet, uint32_t scheduled_for) override;
   mesh::Packet* getNextInbound(uint32_t now) override;
+  bool getNextOutboundTime(uint32_t& when) const override;
+  bool getNextInboundTime(uint32_t& when) const override;
+  uint32_t getNumDropped(int reason) const override { return n_dropped[reason]; }
+  void resetDropCounts() override { memset(n_dropped, 0, sizeof(n_dropped)); }
 };
\ No newline at end of file
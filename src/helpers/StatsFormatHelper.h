@@ -10,11 +10,13 @@ public:
                              uint16_t err_flags,
                              mesh::PacketManager* mgr) {
     sprintf(reply, 
-      "{\"battery_mv\":%u,\"uptime_secs\":%u,\"errors\":%u,\"queue_len\":%u}",
+      "{\"battery_mv\":%u,\"uptime_secs\":%u,\"errors\":%u,\"queue_len\":%u,\"pool_free\":%u,\"pool_peak\":%u}",
       board.getBattMilliVolts(),
       ms.getMillis() / 1000,
       err_flags,
-      mgr->getOutboundTotal()
+      mgr->getOutboundTotal(),
+      mgr->getFreeCount(),
+      mgr->getMaxUsedCount()
     );
   }
 
@@ -1,14 +1,39 @@
 #include "TransportKeyStore.h"
-#include <SHA256.h>
 
 uint16_t TransportKey::calcTransportCode(const mesh::Packet* packet) const {
-  uint16_t code;
-  SHA256 sha;
-  sha.resetHMAC(key, sizeof(key));
+  PreparedTransportKey prepared;
+  prepared.prepare(*this);
+  return prepared.calcTransportCode(packet);
+}
+
+void PreparedTransportKey::prepare(const TransportKey& key) {
+  uint8_t pad[64];   // HMAC-SHA256, with key (always < block size) zero padded
+  memset(pad, 0, sizeof(pad));
+  memcpy(pad, key.key, sizeof(key.key));
+
+  for (int i = 0; i < sizeof(pad); i++) pad[i] ^= 0x36;
+  inner.reset();
+  inner.update(pad, sizeof(pad));
+
+  for (int i = 0; i < sizeof(pad); i++) pad[i] ^= 0x36 ^ 0x5C;
+  outer.reset();
+  outer.update(pad, sizeof(pad));
+
+  memset(pad, 0, sizeof(pad));
+}
+
+uint16_t PreparedTransportKey::calcTransportCode(const mesh::Packet* packet) const {
+  uint8_t hash[32];
+  SHA256 sha = inner;   // resume from the prepared midstates
   uint8_t type = packet->getPayloadType();
   sha.update(&type, 1);
   sha.update(packet->payload, packet->payload_len);
-  sha.finalizeHMAC(key, sizeof(key), &code, 2);
+  sha.finalize(hash, sizeof(hash));
+
+  uint16_t code;
+  sha = outer;
+  sha.update(hash, sizeof(hash));
+  sha.finalize(&code, 2);
   if (code == 0) {     // reserve codes 0000 and FFFF
     code++;
   } else if (code == 0xFFFF) {
@@ -24,69 +49,178 @@ bool TransportKey::isNull() const {
   return true;  // key is all zeroes
 }
 
-void TransportKeyStore::putCache(uint16_t id, const TransportKey& key) {
-  if (num_cache < MAX_TKS_ENTRIES) {
-    cache_ids[num_cache] = id;
-    cache_keys[num_cache] = key;
-    num_cache++;
-  } else {
-    // TODO: evict oldest cache entry
+#define TKS_FILENAME   "/tkeys"
+
+int TransportKeyStore::getCache(uint16_t id, TransportKey keys[], int max_num) {
+  int found = 0, num = -1;
+  for (int i = 0; i < num_cache; i++) {
+    if (cache[i].id == id) {
+      num = cache[i].num;
+      if (found < num && found < max_num) keys[found] = cache[i].key;
+      found++;
+    }
+  }
+  if (num < 0 || found < (num == 0 ? 1 : num)) {   // not cached, or some were evicted
+    cache_misses++;
+    return -1;
+  }
+
+  cache_clock++;
+  for (int i = 0; i < num_cache; i++) {
+    if (cache[i].id == id) cache[i].last_used = cache_clock;
   }
+  cache_hits++;
+  return num < max_num ? num : max_num;
 }
 
-void TransportKeyStore::getAutoKeyFor(uint16_t id, const char* name, TransportKey& dest) {
-  for (int i = 0; i < num_cache; i++) {  // first, check cache
-    if (cache_ids[i] == id) {   // cache hit!
-      dest = cache_keys[i];
-      return;
+void TransportKeyStore::putCache(uint16_t id, const TransportKey keys[], int num) {
+  removeCache(id);
+
+  cache_clock++;
+  for (int j = 0; j < (num == 0 ? 1 : num); j++) {
+    CacheEntry* entry;
+    if (num_cache < MAX_TKS_ENTRIES) {
+      entry = &cache[num_cache++];
+    } else {
+      entry = &cache[0];   // evict least recently used
+      for (int i = 1; i < num_cache; i++) {
+        if (cache[i].last_used < entry->last_used) entry = &cache[i];
+      }
+    }
+    entry->id = id;
+    entry->num = num;
+    entry->last_used = cache_clock;
+    if (num > 0) {
+      entry->key = keys[j];
+    } else {
+      memset(entry->key.key, 0, sizeof(entry->key.key));
     }
   }
+}
+
+void TransportKeyStore::removeCache(uint16_t id) {
+  int i = 0;
+  while (i < num_cache) {
+    if (cache[i].id == id) {
+      cache[i] = cache[--num_cache];   // order doesn't matter
+    } else {
+      i++;
+    }
+  }
+}
+
+void TransportKeyStore::getAutoKeyFor(uint16_t id, const char* name, TransportKey& dest) {
+  if (getCache(id, &dest, 1) == 1) return;   // cache hit!
+
   // calc key for publicly-known hashtag region name
   SHA256 sha;
   sha.update(name, strlen(name));
   sha.finalize(&dest.key, sizeof(dest.key));
 
-  putCache(id, dest);
+  putCache(id, &dest, 1);
 }
 
-int TransportKeyStore::loadKeysFor(uint16_t id, TransportKey keys[], int max_num) {
+int TransportKeyStore::readStored(uint16_t ids[], TransportKey keys[], int max_num) {
+  if (_fs == NULL || !_fs->exists(TKS_FILENAME)) return 0;
+
+#if defined(RP2040_PLATFORM)
+  File file = _fs->open(TKS_FILENAME, "r");
+#else
+  File file = _fs->open(TKS_FILENAME);
+#endif
   int n = 0;
-  for (int i = 0; i < num_cache && n < max_num; i++) {  // first, check cache
-    if (cache_ids[i] == id) {
-      keys[n++] = cache_keys[i];
+  if (file) {
+    while (n < max_num) {
+      bool success = file.read((uint8_t *) &ids[n], sizeof(ids[n])) == sizeof(ids[n]);
+      success = success && file.read(keys[n].key, sizeof(keys[n].key)) == sizeof(keys[n].key);
+      if (!success) break;  // EOF
+
+      n++;
     }
+    file.close();
   }
-  if (n > 0) return n;   // cache hit!
+  return n;
+}
 
-  // TODO:  retrieve from difficult-to-copy keystore
+bool TransportKeyStore::writeStored(const uint16_t ids[], const TransportKey keys[], int num) {
+#if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+  _fs->remove(TKS_FILENAME);
+  File file = _fs->open(TKS_FILENAME, FILE_O_WRITE);
+#elif defined(RP2040_PLATFORM)
+  File file = _fs->open(TKS_FILENAME, "w");
+#else
+  File file = _fs->open(TKS_FILENAME, "w", true);
+#endif
+  if (file) {
+    bool success = true;
+    for (int i = 0; i < num && success; i++) {
+      success = file.write((uint8_t *) &ids[i], sizeof(ids[i])) == sizeof(ids[i]);
+      success = success && file.write(keys[i].key, sizeof(keys[i].key)) == sizeof(keys[i].key);
+    }
+    file.close();
+    MESH_DEBUG_PRINTLN("TransportKeyStore::writeStored() write - %s", success ? "OK" : "Err");
+    return success;
+  }
+  MESH_DEBUG_PRINTLN("TransportKeyStore::writeStored() failed");
+  return false;
+}
 
-  // store in cache (if room)
-  for (int i = 0; i < n; i++) {
-    putCache(id, keys[i]);
+int TransportKeyStore::loadKeysFor(uint16_t id, TransportKey keys[], int max_num) {
+  int n = getCache(id, keys, max_num);
+  if (n >= 0) return n;   // cache hit!
+
+  uint16_t stored_ids[MAX_TKS_STORED];
+  TransportKey stored_keys[MAX_TKS_STORED];
+  int num_stored = readStored(stored_ids, stored_keys, MAX_TKS_STORED);
+
+  TransportKey found[MAX_TKS_KEYS_PER_ID];
+  n = 0;
+  for (int i = 0; i < num_stored && n < MAX_TKS_KEYS_PER_ID; i++) {
+    if (stored_ids[i] == id) found[n++] = stored_keys[i];
   }
+  putCache(id, found, n);   // NOTE: also caches none found, so a '$' region with no keys doesn't hit flash every time
+
+  if (n > max_num) n = max_num;
+  for (int i = 0; i < n; i++) keys[i] = found[i];
   return n;
 }
 
 bool TransportKeyStore::saveKeysFor(uint16_t id, const TransportKey keys[], int num) {
-  invalidateCache();
+  if (_fs == NULL || num > MAX_TKS_KEYS_PER_ID) return false;
+
+  uint16_t stored_ids[MAX_TKS_STORED];
+  TransportKey stored_keys[MAX_TKS_STORED];
+  int num_stored = readStored(stored_ids, stored_keys, MAX_TKS_STORED);
+
+  int n = 0;   // remove existing keys for 'id'
+  for (int i = 0; i < num_stored; i++) {
+    if (stored_ids[i] != id) {
+      stored_ids[n] = stored_ids[i];
+      stored_keys[n] = stored_keys[i];
+      n++;
+    }
+  }
+  if (n + num > MAX_TKS_STORED) return false;   // full!
 
-  // TODO: update hardware keystore
+  for (int i = 0; i < num; i++, n++) {
+    stored_ids[n] = id;
+    stored_keys[n] = keys[i];
+  }
+  bool success = writeStored(stored_ids, stored_keys, n);
 
-  return false;  // failed
+  removeCache(id);
+  version++;
+  return success;
 }
 
 bool TransportKeyStore::removeKeys(uint16_t id) {
-  invalidateCache();
-
-  // TODO: remove from hardware keystore
-
-  return false;  // failed
+  return saveKeysFor(id, NULL, 0);
 }
 
 bool TransportKeyStore::clear() {
   invalidateCache();
 
-  // TODO: clear hardware keystore
-
-  return false;  // failed
+  if (_fs == NULL) return false;
+  if (_fs->exists(TKS_FILENAME)) _fs->remove(TKS_FILENAME);
+  return true;  // success
 }
@@ -3,6 +3,7 @@
 #include <Arduino.h>   // needed for PlatformIO
 #include <Packet.h>
 #include <helpers/IdentityStore.h>
+#include <SHA256.h>
 
 struct TransportKey {
   uint8_t key[16];
@@ -11,21 +12,75 @@ struct TransportKey {
   bool isNull() const;
 };
 
-#define MAX_TKS_ENTRIES   16
+/**
+ * \brief  A TransportKey with its HMAC inner/outer pads already hashed, so each calcTransportCode() only has to
+ *     hash the packet (saves two SHA-256 blocks per call).
+*/
+struct PreparedTransportKey {
+  SHA256 inner, outer;
 
+  void prepare(const TransportKey& key);
+  uint16_t calcTransportCode(const mesh::Packet* packet) const;
+};
+
+#ifndef MAX_TKS_ENTRIES
+  #define MAX_TKS_ENTRIES   32    // num keys cached in RAM, ideally >= num regions (plus extra keys of private regions)
+#endif
+#ifndef MAX_TKS_STORED
+  #define MAX_TKS_STORED    32    // num private region keys the on-flash keystore can hold
+#endif
+#define MAX_TKS_KEYS_PER_ID  4
+
+/**
+ * \brief  Transport keys, per region id. Auto (hashtag) keys are derived from the region name, private ('$') region
+ *     keys are kept in a file. Either way, recently used keys are held in a small LRU cache.
+*/
 class TransportKeyStore {
-  uint16_t     cache_ids[MAX_TKS_ENTRIES];
-  TransportKey cache_keys[MAX_TKS_ENTRIES];
+  struct CacheEntry {
+    uint16_t     id;
+    uint8_t      num;        // total keys for this id, zero means none (ie. a cached 'miss', key is unused)
+    uint32_t     last_used;
+    TransportKey key;
+  };
+  CacheEntry cache[MAX_TKS_ENTRIES];
   int num_cache;
+  uint32_t cache_clock;
+  uint32_t cache_hits, cache_misses;
+  uint16_t version;
+  FILESYSTEM* _fs;
+
+  int getCache(uint16_t id, TransportKey keys[], int max_num);
+  void putCache(uint16_t id, const TransportKey keys[], int num);
+  void removeCache(uint16_t id);
+  void invalidateCache() { num_cache = 0; version++; }
 
-  void putCache(uint16_t id, const TransportKey& key);
-  void invalidateCache() { num_cache = 0; }
+  int readStored(uint16_t ids[], TransportKey keys[], int max_num);
+  bool writeStored(const uint16_t ids[], const TransportKey keys[], int num);
 
 public:
-  TransportKeyStore() { num_cache = 0; }
+  TransportKeyStore() {
+    num_cache = 0; cache_clock = 0; version = 0; _fs = NULL;
+    cache_hits = cache_misses = 0;
+  }
+
+  /**
+   * \brief  enables the on-flash keystore, for private region keys
+  */
+  void begin(FILESYSTEM* fs) { _fs = fs; invalidateCache(); }
+
+  /**
+   * \returns  a counter which changes whenever any stored keys may have changed
+  */
+  uint16_t getVersion() const { return version; }
+
   void getAutoKeyFor(uint16_t id, const char* name, TransportKey& dest);
   int loadKeysFor(uint16_t id, TransportKey keys[], int max_num);
   bool saveKeysFor(uint16_t id, const TransportKey keys[], int num);
   bool removeKeys(uint16_t id);
   bool clear();
+
+  int getNumCached() const { return num_cache; }
+  uint32_t getNumCacheHits() const { return cache_hits; }
+  uint32_t getNumCacheMisses() const { return cache_misses; }
+  void resetStats() { cache_hits = cache_misses = 0; }
 };
@@ -11,10 +11,11 @@ public:
     return ((CustomLLCC68 *)_radio)->isReceiving();
   }
   float getCurrentRSSI() override {
+    RecvIRQMask mask(this);
     return ((CustomLLCC68 *)_radio)->getRSSI(false);
   }
-  float getLastRSSI() const override { return ((CustomLLCC68 *)_radio)->getRSSI(); }
-  float getLastSNR() const override { return ((CustomLLCC68 *)_radio)->getSNR(); }
+  float getPacketRSSI() const override { return ((CustomLLCC68 *)_radio)->getRSSI(); }
+  float getPacketSNR() const override { return ((CustomLLCC68 *)_radio)->getSNR(); }
 
   float packetScore(float snr, int packet_len) override {
     int sf = ((CustomLLCC68 *)_radio)->spreadingFactor;
@@ -24,9 +25,11 @@ public:
   void doResetAGC() override { sx126xResetAGC((SX126x *)_radio); }
 
   void setRxBoostedGainMode(bool en) override {
+    RecvIRQMask mask(this);
     ((CustomLLCC68 *)_radio)->setRxBoostedGainMode(en);
   }
   bool getRxBoostedGainMode() const override {
+    RecvIRQMask mask(this);
     return ((CustomLLCC68 *)_radio)->getRxBoostedGainMode();
   }
 };
@@ -12,23 +12,27 @@ public:
     return ((CustomLR1110 *)_radio)->isReceiving();
   }
   float getCurrentRSSI() override {
+    RecvIRQMask mask(this);
     float rssi = -110;
     ((CustomLR1110 *)_radio)->getRssiInst(&rssi);
     return rssi;
   }
 
   void onSendFinished() override {
+    RecvIRQMask mask(this);
     RadioLibWrapper::onSendFinished();
     _radio->setPreambleLength(16); // overcomes weird issues with small and big pkts
   }
 
-  float getLastRSSI() const override { return ((CustomLR1110 *)_radio)->getRSSI(); }
-  float getLastSNR() const override { return ((CustomLR1110 *)_radio)->getSNR(); }
+  float getPacketRSSI() const override { return ((CustomLR1110 *)_radio)->getRSSI(); }
+  float getPacketSNR() const override { return ((CustomLR1110 *)_radio)->getSNR(); }
 
   void setRxBoostedGainMode(bool en) override {
+    RecvIRQMask mask(this);
     ((CustomLR1110 *)_radio)->setRxBoostedGainMode(en);
   }
   bool getRxBoostedGainMode() const override {
+    RecvIRQMask mask(this);
     return ((CustomLR1110 *)_radio)->getRxBoostedGainMode();
   }
 };
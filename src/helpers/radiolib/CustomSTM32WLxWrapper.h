@@ -12,10 +12,11 @@ public:
     return ((CustomSTM32WLx *)_radio)->isReceiving();
   }
   float getCurrentRSSI() override {
+    RecvIRQMask mask(this);
     return ((CustomSTM32WLx *)_radio)->getRSSI(false);
   }
-  float getLastRSSI() const override { return ((CustomSTM32WLx *)_radio)->getRSSI(); }
-  float getLastSNR() const override { return ((CustomSTM32WLx *)_radio)->getSNR(); }
+  float getPacketRSSI() const override { return ((CustomSTM32WLx *)_radio)->getRSSI(); }
+  float getPacketSNR() const override { return ((CustomSTM32WLx *)_radio)->getSNR(); }
 
   float packetScore(float snr, int packet_len) override {
     int sf = ((CustomSTM32WLx *)_radio)->spreadingFactor;
@@ -15,25 +15,29 @@ public:
     return ((CustomSX1262 *)_radio)->isReceiving();
   }
   float getCurrentRSSI() override {
+    RecvIRQMask mask(this);
     return ((CustomSX1262 *)_radio)->getRSSI(false);
   }
-  float getLastRSSI() const override { return ((CustomSX1262 *)_radio)->getRSSI(); }
-  float getLastSNR() const override { return ((CustomSX1262 *)_radio)->getSNR(); }
+  float getPacketRSSI() const override { return ((CustomSX1262 *)_radio)->getRSSI(); }
+  float getPacketSNR() const override { return ((CustomSX1262 *)_radio)->getSNR(); }
 
   float packetScore(float snr, int packet_len) override {
     int sf = ((CustomSX1262 *)_radio)->spreadingFactor;
     return packetScoreInt(snr, sf, packet_len);
   }
   virtual void powerOff() override {
+    RecvIRQMask mask(this);
     ((CustomSX1262 *)_radio)->sleep(false);
   }
 
   void doResetAGC() override { sx126xResetAGC((SX126x *)_radio); }
 
   void setRxBoostedGainMode(bool en) override {
+    RecvIRQMask mask(this);
     ((CustomSX1262 *)_radio)->setRxBoostedGainMode(en);
   }
   bool getRxBoostedGainMode() const override {
+    RecvIRQMask mask(this);
     return ((CustomSX1262 *)_radio)->getRxBoostedGainMode();
   }
 };
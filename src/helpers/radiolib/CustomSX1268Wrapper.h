@@ -15,10 +15,11 @@ public:
     return ((CustomSX1268 *)_radio)->isReceiving();
   }
   float getCurrentRSSI() override {
+    RecvIRQMask mask(this);
     return ((CustomSX1268 *)_radio)->getRSSI(false);
   }
-  float getLastRSSI() const override { return ((CustomSX1268 *)_radio)->getRSSI(); }
-  float getLastSNR() const override { return ((CustomSX1268 *)_radio)->getSNR(); }
+  float getPacketRSSI() const override { return ((CustomSX1268 *)_radio)->getRSSI(); }
+  float getPacketSNR() const override { return ((CustomSX1268 *)_radio)->getSNR(); }
 
   float packetScore(float snr, int packet_len) override {
     int sf = ((CustomSX1268 *)_radio)->spreadingFactor;
@@ -28,9 +29,11 @@ public:
   void doResetAGC() override { sx126xResetAGC((SX126x *)_radio); }
 
   void setRxBoostedGainMode(bool en) override {
+    RecvIRQMask mask(this);
     ((CustomSX1268 *)_radio)->setRxBoostedGainMode(en);
   }
   bool getRxBoostedGainMode() const override {
+    RecvIRQMask mask(this);
     return ((CustomSX1268 *)_radio)->getRxBoostedGainMode();
   }
 };
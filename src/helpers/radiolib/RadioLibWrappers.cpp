@@ -13,6 +13,10 @@
 
 static volatile uint8_t state = STATE_IDLE;
 
+#if RADIO_RX_IN_ISR
+static RadioLibWrapper* isr_wrapper = NULL;
+#endif
+
 // this function is called when a complete packet
 // is transmitted by the module
 static 
@@ -24,9 +28,46 @@ void setFlag(void) {
   state |= STATE_INT_READY;
 }
 
+#if RADIO_RX_IN_ISR
+void
+#if defined(ESP8266)
+  ICACHE_RAM_ATTR
+#endif
+RadioLibWrapper::onRadioIRQ() {
+  setFlag();
+  auto w = isr_wrapper;
+  if (w && w->irq_mask == 0) w->pollRecv();   // read packet now, before the next one overwrites it. Else on unmask
+}
+
+bool RadioLibWrapper::isRecvPending() const {
+  uint8_t s = state;
+  return (s & STATE_INT_READY) != 0 && (s & ~STATE_INT_READY) != STATE_TX_WAIT
+      && (uint8_t)(rx_head - rx_tail) < RADIO_RX_QUEUE_SIZE;
+}
+
+void RadioLibWrapper::unmaskRecvIRQ() {
+  for (;;) {
+    noInterrupts();   // IRQ after the check must find mask released, and read the packet itself
+    bool pending = irq_mask == 1 && isRecvPending();
+    if (!pending) irq_mask--;
+    interrupts();
+    if (!pending) break;
+    pollRecv();   // came while masked, so the IRQ handler left it
+  }
+}
+#endif
+
 void RadioLibWrapper::begin() {
+  RecvIRQMask mask(this);
+#if RADIO_RX_IN_ISR
+  isr_wrapper = this;
+  _radio->setPacketReceivedAction(onRadioIRQ);  // this is also SentComplete interrupt
+#else
   _radio->setPacketReceivedAction(setFlag);  // this is also SentComplete interrupt
+#endif
   state = STATE_IDLE;
+  rx_head = rx_tail = 0;
+  onParamsChanged();
 
   if (_board->getStartupReason() == BD_STARTUP_RX_PACKET) {  // received a LoRa packet (while in deep sleep)
     setFlag(); // LoRa packet is already received
@@ -58,6 +99,8 @@ void RadioLibWrapper::doResetAGC() {
 }
 
 void RadioLibWrapper::resetAGC() {
+  RecvIRQMask mask(this);
+
   // make sure we're not mid-receive of packet!
   if ((state & STATE_INT_READY) != 0 || isReceivingPacket()) return;
 
@@ -74,6 +117,9 @@ void RadioLibWrapper::resetAGC() {
 }
 
 void RadioLibWrapper::loop() {
+  RecvIRQMask mask(this);
+  pollRecv();
+
   if (state == STATE_RX && _num_floor_samples < NUM_NOISE_FLOOR_SAMPLES) {
     if (!isReceivingPacket()) {
       int rssi = getCurrentRSSI();
@@ -106,41 +152,84 @@ bool RadioLibWrapper::isInRecvMode() const {
   return (state & ~STATE_INT_READY) == STATE_RX;
 }
 
-int RadioLibWrapper::recvRaw(uint8_t* bytes, int sz) {
-  int len = 0;
-  if (state & STATE_INT_READY) {
-    len = _radio->getPacketLength();
-    if (len > 0) {
-      if (len > sz) { len = sz; }
-      int err = _radio->readData(bytes, len);
-      if (err != RADIOLIB_ERR_NONE) {
-        MESH_DEBUG_PRINTLN("RadioLibWrapper: error: readData(%d)", err);
-        len = 0;
-        n_recv_errors++;
-      } else {
-      //  Serial.print("  readData() -> "); Serial.println(len);
-        n_recv++;
-      }
-    }
-    state = STATE_IDLE;   // need another startReceive()
+bool RadioLibWrapper::needsPolling() const {
+  if (state != STATE_RX || rx_head != rx_tail) return true;   // packet ready to read, or need another startReceive()
+
+  // noise floor only needs continual sampling if the interference check is enabled
+  return _threshold != 0 && _num_floor_samples < NUM_NOISE_FLOOR_SAMPLES;
+}
+
+bool RadioLibWrapper::pollRecv() {
+  uint8_t s = state;
+  if ((s & STATE_INT_READY) == 0 || (s & ~STATE_INT_READY) == STATE_TX_WAIT) return false;   // no packet received (or is TX complete)
+
+  if ((uint8_t)(rx_head - rx_tail) >= RADIO_RX_QUEUE_SIZE) {   // queue full, leave it in radio until recvRaw() pops one
+    n_recv_queue_full++;
+    return false;
   }
 
-  if (state != STATE_RX) {
-    int err = _radio->startReceive();
-    if (err == RADIOLIB_ERR_NONE) {
-      state = STATE_RX;
+  auto slot = &rx_queue[rx_head % RADIO_RX_QUEUE_SIZE];
+  bool queued = false;
+  int len = _radio->getPacketLength();
+  if (len > 0) {
+    if (len > (int) sizeof(slot->data)) { len = sizeof(slot->data); }
+    int err = _radio->readData(slot->data, len);
+    if (err != RADIOLIB_ERR_NONE) {
+      MESH_DEBUG_PRINTLN("RadioLibWrapper: error: readData(%d)", err);
+      n_recv_errors++;
     } else {
-      MESH_DEBUG_PRINTLN("RadioLibWrapper: error: startReceive(%d)", err);
+      slot->len = len;
+      slot->snr = getPacketSNR();
+      slot->rssi = getPacketRSSI();
+      slot->at = millis();
+      rx_head++;   // publish, NOTE: only after slot is filled in
+      n_recv++;
+      queued = true;
     }
   }
+
+  state = STATE_IDLE;
+  startRecv();
+  return queued;
+}
+
+int RadioLibWrapper::recvRaw(uint8_t* bytes, int sz) {
+  RecvIRQMask mask(this);
+  pollRecv();
+
+  int len = 0;
+  if (rx_tail != rx_head) {
+    auto slot = &rx_queue[rx_tail % RADIO_RX_QUEUE_SIZE];
+    len = slot->len;
+    if (len > sz) { len = sz; }
+    memcpy(bytes, slot->data, len);
+    last_snr = slot->snr;
+    last_rssi = slot->rssi;
+    last_recv_at = slot->at;
+    rx_tail++;   // slot can now be re-used
+
+    pollRecv();   // in case one was left in radio, as queue was full
+  }
+
+  if (state != STATE_RX && (state & STATE_INT_READY) == 0) {
+    startRecv();
+  }
   return len;
 }
 
 uint32_t RadioLibWrapper::getEstAirtimeFor(int len_bytes) {
-  return _radio->getTimeOnAir(len_bytes) / 1000;
+  if (len_bytes < 0 || len_bytes > MAX_TRANS_UNIT) return _radio->getTimeOnAir(len_bytes) / 1000;
+
+  uint32_t t = airtime_cache[len_bytes];
+  if (t == 0) {   // not cached (getTimeOnAir() is float heavy, and called several times per packet)
+    t = _radio->getTimeOnAir(len_bytes) / 1000;
+    if (t < 0xFFFF) airtime_cache[len_bytes] = t;   // else too big to cache (extreme params), calc each time
+  }
+  return t;
 }
 
 bool RadioLibWrapper::startSendRaw(const uint8_t* bytes, int len) {
+  RecvIRQMask mask(this);
   _board->onBeforeTransmit();
   int err = _radio->startTransmit((uint8_t *) bytes, len);
   if (err == RADIOLIB_ERR_NONE) {
@@ -163,6 +252,7 @@ bool RadioLibWrapper::isSendComplete() {
 }
 
 void RadioLibWrapper::onSendFinished() {
+  RecvIRQMask mask(this);
   _radio->finishTransmit();
   _board->onAfterTransmit();
   state = STATE_IDLE;
@@ -174,13 +264,6 @@ bool RadioLibWrapper::isChannelActive() {
           : getCurrentRSSI() > _noise_floor + _threshold;
 }
 
-float RadioLibWrapper::getLastRSSI() const {
-  return _radio->getRSSI();
-}
-float RadioLibWrapper::getLastSNR() const {
-  return _radio->getSNR();
-}
-
 // Approximate SNR threshold per SF for successful reception (based on Semtech datasheets)
 static float snr_threshold[] = {
     -7.5,  // SF7 needs at least -7.5 dB SNR
@@ -3,11 +3,52 @@
 #include <Mesh.h>
 #include <RadioLib.h>
 
+#ifndef RADIO_RX_QUEUE_SIZE
+  #define RADIO_RX_QUEUE_SIZE   1    // num received packets which can be held, waiting for recvRaw() (~264 bytes each)
+#endif
+
+#ifndef RADIO_RX_IN_ISR
+  #define RADIO_RX_IN_ISR   0   // 1 = radio IRQ handler reads each received packet into the queue (see RecvIRQMask)
+#endif
+
+#if RADIO_RX_IN_ISR && defined(ESP32)
+  #error "RADIO_RX_IN_ISR: the ESP32 SPI driver takes a mutex, so can't be used from an IRQ handler"
+#endif
+
+// rx_head/rx_tail are uint8_t, so index with % only stays in step across their wrap if size divides 256
+static_assert(RADIO_RX_QUEUE_SIZE > 0 && RADIO_RX_QUEUE_SIZE <= 128 && (RADIO_RX_QUEUE_SIZE & (RADIO_RX_QUEUE_SIZE - 1)) == 0,
+              "RADIO_RX_QUEUE_SIZE must be a power of two, 1 to 128");
+
+/**
+ * \brief  a received packet, with its signal info, waiting to be returned by recvRaw()
+*/
+struct RadioRecvSlot {
+  uint32_t at;     // millis() when read from radio
+  float snr, rssi;
+  uint16_t len;
+  uint8_t data[MAX_TRANS_UNIT];
+};
+
 class RadioLibWrapper : public mesh::Radio {
+  // ring buffer, filled by pollRecv() (from the IRQ handler with RADIO_RX_IN_ISR), emptied by recvRaw()
+  RadioRecvSlot rx_queue[RADIO_RX_QUEUE_SIZE];
+  volatile uint8_t rx_head, rx_tail;   // push at head, pop at tail
+  volatile uint8_t irq_mask;   // num RecvIRQMask held (main loop is using the radio)
+  float last_snr, last_rssi;
+  uint32_t last_recv_at;
+  uint16_t airtime_cache[MAX_TRANS_UNIT + 1];   // millis, by packet length. zero = not calculated yet
+
+  bool pollRecv();
+#if RADIO_RX_IN_ISR
+  static void onRadioIRQ();
+  bool isRecvPending() const;
+  void unmaskRecvIRQ();
+#endif
+
 protected:
   PhysicalLayer* _radio;
   mesh::MainBoard* _board;
-  uint32_t n_recv, n_sent, n_recv_errors;
+  uint32_t n_recv, n_sent, n_recv_errors, n_recv_queue_full;
   int16_t _noise_floor, _threshold;
   uint16_t _num_floor_samples;
   int32_t _floor_sample_sum;
@@ -18,20 +59,59 @@ protected:
   virtual bool isReceivingPacket() =0;
   virtual void doResetAGC();
 
+  /**
+   * \brief  signal info of the packet just received (ie. read from the radio)
+  */
+  virtual float getPacketRSSI() const { return _radio->getRSSI(); }
+  virtual float getPacketSNR() const { return _radio->getSNR(); }
+
 public:
-  RadioLibWrapper(PhysicalLayer& radio, mesh::MainBoard& board) : _radio(&radio), _board(&board) { n_recv = n_sent = 0; }
+  RadioLibWrapper(PhysicalLayer& radio, mesh::MainBoard& board) : _radio(&radio), _board(&board) {
+    n_recv = n_sent = n_recv_errors = n_recv_queue_full = 0;
+    rx_head = rx_tail = irq_mask = 0;
+    last_snr = last_rssi = 0;
+    last_recv_at = 0;
+    memset(airtime_cache, 0, sizeof(airtime_cache));
+  }
 
   void begin() override;
-  virtual void powerOff() { _radio->sleep(); }
+  virtual void powerOff() { RecvIRQMask mask(this); _radio->sleep(); }
   int recvRaw(uint8_t* bytes, int sz) override;
+
+  /**
+   * \brief  with RADIO_RX_IN_ISR, keeps the IRQ handler off the radio (and its SPI bus) while held. A packet received
+   *        meanwhile is read when the last mask is released. The wrapper's own methods hold one; other code using the
+   *        radio or the SPI bus (eg. radio_set_params()) must too. No-op otherwise.
+  */
+  class RecvIRQMask {
+#if RADIO_RX_IN_ISR
+    RadioLibWrapper* _wrapper;
+  public:
+    RecvIRQMask(const RadioLibWrapper* wrapper) : _wrapper((RadioLibWrapper *) wrapper) { _wrapper->irq_mask++; }
+    ~RecvIRQMask() { _wrapper->unmaskRecvIRQ(); }
+#else
+  public:
+    RecvIRQMask(const RadioLibWrapper* wrapper) { }
+#endif
+  };
+
+  int getNumRecvQueued() const { return (uint8_t)(rx_head - rx_tail); }
+
+  /**
+   * \returns  millis() when the packet last returned by recvRaw() was read from the radio
+  */
+  uint32_t getLastRecvTime() const { return last_recv_at; }
   uint32_t getEstAirtimeFor(int len_bytes) override;
+  void onParamsChanged() override { memset(airtime_cache, 0, sizeof(airtime_cache)); }
   bool startSendRaw(const uint8_t* bytes, int len) override;
   bool isSendComplete() override;
   void onSendFinished() override;
   bool isInRecvMode() const override;
+  bool needsPolling() const override;
   bool isChannelActive();
 
   bool isReceiving() override { 
+    RecvIRQMask mask(this);
     if (isReceivingPacket()) return true;
 
     return isChannelActive();
@@ -47,11 +127,12 @@ public:
 
   uint32_t getPacketsRecv() const { return n_recv; }
   uint32_t getPacketsRecvErrors() const { return n_recv_errors; }
+  uint32_t getPacketsRecvQueueFull() const { return n_recv_queue_full; }
   uint32_t getPacketsSent() const { return n_sent; }
-  void resetStats() { n_recv = n_sent = n_recv_errors = 0; }
+  void resetStats() { n_recv = n_sent = n_recv_errors = n_recv_queue_full = 0; }
 
-  virtual float getLastRSSI() const override;
-  virtual float getLastSNR() const override;
+  float getLastRSSI() const override { return last_rssi; }
+  float getLastSNR() const override { return last_snr; }
 
   float packetScore(float snr, int packet_len) override { return packetScoreInt(snr, 10, packet_len); }  // assume sf=10
 
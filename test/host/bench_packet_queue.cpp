@@ -0,0 +1,171 @@
+// PacketQueue (binary heaps) vs. the original linear-scan queue: equivalence check, and cost per
+// get() at 16, 64 and 256 entries. Also times a Dispatcher::checkSend() style step on the
+// StaticPoolPacketManager (at-risk scan, expiry purge, class-masked get).
+#include <helpers/StaticPoolPacketManager.h>
+#include <chrono>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+// the original PacketQueue algorithm, as reference
+class LinearQueue {
+  std::vector<mesh::Packet*> _table;
+  std::vector<uint8_t> _pri;
+  std::vector<uint32_t> _sched;
+  int _size;
+
+public:
+  LinearQueue(int max_entries) : _size(max_entries) { }
+  int count() const { return _table.size(); }
+
+  bool add(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for) {
+    if (count() == _size) return false;
+    _table.push_back(packet); _pri.push_back(priority); _sched.push_back(scheduled_for);
+    return true;
+  }
+  int countBefore(uint32_t now) const {
+    int n = 0;
+    for (int j = 0; j < count(); j++) if ((int32_t)(_sched[j] - now) <= 0) n++;
+    return n;
+  }
+  mesh::Packet* get(uint32_t now) {
+    uint8_t min_pri = 0xFF;
+    int best = -1;
+    for (int j = 0; j < count(); j++) {
+      if ((int32_t)(_sched[j] - now) > 0) continue;
+      if (_pri[j] < min_pri) { min_pri = _pri[j]; best = j; }
+    }
+    if (best < 0) return NULL;
+    mesh::Packet* top = _table[best];
+    _table.erase(_table.begin() + best); _pri.erase(_pri.begin() + best); _sched.erase(_sched.begin() + best);
+    return top;
+  }
+};
+
+static double nsSince(std::chrono::steady_clock::time_point t0) {
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static bool checkEquivalent() {
+  for (int round = 0; round < 200; round++) {
+    int n = 1 + rand() % 64;
+    PacketQueue heap(n);
+    LinearQueue linear(n);
+    std::vector<mesh::Packet> pkts(n);
+    std::vector<mesh::Packet*> free_list;
+    for (auto& p : pkts) free_list.push_back(&p);
+    uint32_t now = 0xFFFF0000u + rand();   // include millis() wrap
+
+    for (int step = 0; step < 2000; step++) {
+      int op = rand() % 3;
+      if (op == 0 && !free_list.empty()) {
+        mesh::Packet* p = free_list.back(); free_list.pop_back();
+        uint8_t pri = rand() % 6;
+        uint32_t sched = now + (rand() % 200) - 50;
+        if (heap.add(p, pri, sched) != linear.add(p, pri, sched)) { printf("FAIL: add() differs\n"); return false; }
+      } else if (op == 1) {
+        if (heap.countBefore(now) != linear.countBefore(now)) { printf("FAIL: countBefore() differs\n"); return false; }
+        mesh::Packet* a = heap.get(now);
+        if (a != linear.get(now)) { printf("FAIL: get() differs, step %d\n", step); return false; }
+        if (a) free_list.push_back(a);
+      } else {
+        now += rand() % 30;
+      }
+    }
+  }
+  printf("heap queue matches linear queue\n");
+  return true;
+}
+
+// the expiry/deadline fast paths must never hand out a stale packet, nor purge a live one
+static bool checkExpiry() {
+  StaticPoolPacketManager mgr(32);
+  std::vector<uint32_t> expires(32);
+  mesh::Packet* base = mgr.allocNew();
+  mgr.free(base);
+  uint32_t now = 0xFFFFF000u;   // include millis() wrap
+  long n_queued = 0, n_sent = 0;
+  for (int step = 0; step < 200000; step++) {
+    if (rand() % 2) {
+      mesh::Packet* p = mgr.allocNew();
+      if (p) {
+        uint32_t sched = now + rand() % 100;
+        uint32_t exp = rand() % 4 ? sched + 1 + rand() % 300 : 0;
+        expires[p - base] = exp;
+        mgr.queueOutbound(p, rand() % 4, sched, exp, rand() % 3 ? 0 : sched + rand() % 200);
+        n_queued++;
+      }
+    }
+    now += rand() % 8;
+    int i = mgr.findOutboundAtRisk(now, 50, TX_CLASS_MASK_ALL);
+    mesh::Packet* p = i >= 0 ? mgr.removeOutboundByIdx(i) : mgr.getNextOutbound(now, TX_CLASS_MASK_ALL);
+    if (p) {
+      uint32_t exp = expires[p - base];
+      if (exp && (int32_t)(now - exp) > 0) { printf("FAIL: expired packet returned\n"); return false; }
+      mgr.free(p);
+      n_sent++;
+    }
+  }
+  long n_dropped = mgr.getNumDropped(DROP_TX_EXPIRED) + mgr.getNumDropped(DROP_TX_EVICTED) + mgr.getNumDropped(DROP_TX_QUEUE_FULL);
+  if (n_sent + n_dropped + mgr.getOutboundTotal() != n_queued) { printf("FAIL: packets lost\n"); return false; }
+  printf("no expired packets sent (%ld sent, %u expired)\n", n_sent, mgr.getNumDropped(DROP_TX_EXPIRED));
+  return true;
+}
+
+template <class Q>
+static double timeGets(Q& q, std::vector<mesh::Packet>& pkts) {
+  int n = pkts.size();
+  uint32_t now = 0;
+  long ops = 0;
+  volatile long sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int it = 0; it < 20000; it++) {
+    for (int i = 0; q.count() < n; i++) q.add(&pkts[i % n], rand() % 6, now + rand() % 5000);  // keep full, mostly future
+    for (int k = 0; k < 8; k++) {
+      now++;
+      sink += q.countBefore(now);
+      sink += q.get(now) != NULL;
+      ops++;
+    }
+  }
+  return nsSince(t0) / ops;
+}
+
+static double timeSendSteps(int n, uint8_t class_mask, bool with_deadlines) {
+  StaticPoolPacketManager mgr(n + 2);
+  uint32_t now = 1000;
+  long ops = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int it = 0; it < 100000; it++) {
+    while (mgr.getOutboundTotal() < n) {
+      mesh::Packet* p = mgr.allocNew();
+      p->_tx_class = rand() % 4;
+      uint32_t sched = now + rand() % 2000;
+      mgr.queueOutbound(p, rand() % 6, sched, sched + 5000, with_deadlines && (rand() & 1) ? sched + 3000 : 0);
+    }
+    now += 2;
+    int i = mgr.findOutboundAtRisk(now, 500, class_mask);
+    mesh::Packet* p = i >= 0 ? mgr.removeOutboundByIdx(i) : mgr.getNextOutbound(now, class_mask);
+    if (p) mgr.free(p);
+    ops++;
+  }
+  return nsSince(t0) / ops;
+}
+
+int main() {
+  if (!checkEquivalent() || !checkExpiry()) return 1;
+
+  for (int n : {16, 64, 256}) {
+    std::vector<mesh::Packet> pkts(n);
+    PacketQueue heap(n);
+    LinearQueue linear(n);
+    double h = timeGets(heap, pkts);
+    double l = timeGets(linear, pkts);
+    printf("N=%3d  countBefore+get: heap %6.1f ns, linear %6.1f ns\n", n, h, l);
+  }
+  for (int n : {16, 64, 256}) {
+    printf("N=%3d  send step: all classes %6.1f ns, class-masked %6.1f ns, with deadlines %6.1f ns\n", n,
+      timeSendSteps(n, TX_CLASS_MASK_ALL, false), timeSendSteps(n, 0x0B, false), timeSendSteps(n, TX_CLASS_MASK_ALL, true));
+  }
+  return 0;
+}
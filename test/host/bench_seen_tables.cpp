@@ -0,0 +1,72 @@
+// BloomMeshTables vs SimpleMeshTables: false-positive rate (new packets wrongly 'seen'), how far back a
+// duplicate is still caught, RAM, and cost per hasSeen().
+#include <helpers/SimpleMeshTables.h>
+#include <helpers/BloomMeshTables.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <initializer_list>
+
+struct TestClock : mesh::MillisecondClock {
+  unsigned long t = 1000;
+  unsigned long getMillis() override { return t; }
+};
+
+static mesh::Packet pkt;
+
+static mesh::Packet* packetFor(uint64_t id) {
+  pkt.header = (PAYLOAD_TYPE_TXT_MSG << PH_TYPE_SHIFT) | ROUTE_TYPE_FLOOD;
+  pkt.payload_len = 20;
+  memset(pkt.payload, 0, pkt.payload_len);
+  memcpy(pkt.payload, &id, 8);
+  pkt.invalidateHash();
+  return &pkt;
+}
+
+// returns false-positive rate (percent)
+template <class T>
+static double run(const char* name, T& tables, int ram) {
+  const int N = 200000;
+  int false_pos = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint64_t i = 1; i <= N; i++) {
+    if (tables.hasSeen(packetFor(i))) false_pos++;   // all distinct, so any 'seen' is false
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / N;
+  double fp_pct = 100.0 * false_pos / N;
+
+  printf("%-22s RAM ~%5d B  FP %.3f%%  %4.0f ns/lookup  dup caught by age:", name, ram, fp_pct, ns);
+  for (int age : {50, 100, 190, 400, 600, 800, 1000}) {
+    int caught = 0, trials = 200;
+    for (int r = 0; r < trials; r++) {
+      uint64_t base = 1000000 + r*100000ull;
+      for (uint64_t i = 0; i <= (uint64_t)age; i++) tables.hasSeen(packetFor(base + i));
+      if (tables.hasSeen(packetFor(base))) caught++;
+    }
+    printf(" %d:%d%%", age, 100*caught/trials);
+  }
+  printf("\n");
+  return fp_pct;
+}
+
+int main() {
+  TestClock clock;
+  int index_h = 8, index_a = 8;   // as per SeenTable (both tables, to compare with Bloom)
+  while (index_h < MAX_PACKET_HASHES*2) index_h <<= 1;
+  while (index_a < MAX_PACKET_ACKS*2) index_a <<= 1;
+  SimpleMeshTables simple;
+  simple.setClock(&clock);   // NOTE: clock stays still, so entries are only displaced
+  double simple_fp = run("SimpleMeshTables", simple,
+      MAX_PACKET_HASHES*(MAX_HASH_SIZE + 4) + index_h*2 + MAX_PACKET_ACKS*(ACK_KEY_SIZE + 4) + index_a*2);
+
+  BloomMeshTables bloom;
+  double bloom_fp = run("BloomMeshTables", bloom, (int)sizeof(BloomMeshTables));
+
+  double m = BLOOM_FILTER_BYTES*8, n = BLOOM_FILTER_CAPACITY, k = BLOOM_NUM_HASHES;
+  double worst = pow(1 - exp(-k*n/m), k);
+  printf("Bloom theory: one full filter %.2f%%, both (worst case) %.2f%%\n", 100*worst, 100*(1 - (1 - worst)*(1 - worst)));
+
+  if (simple_fp != 0) { printf("FAIL: SimpleMeshTables has false positives\n"); return 1; }
+  if (bloom_fp > 100*(1 - (1 - worst)*(1 - worst))) { printf("FAIL: Bloom FP rate above worst case\n"); return 1; }
+  return 0;
+}
@@ -0,0 +1,13 @@
+#pragma once
+// Minimal Arduino shim, for building core sources on the host (see ../README.md)
+#include <Stream.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+using std::min; using std::max;
+
+extern Stream Serial;
+unsigned long millis();
+long random(long min, long max);
+inline void noInterrupts() { }
+inline void interrupts() { }
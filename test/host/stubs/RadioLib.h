@@ -0,0 +1,22 @@
+#pragma once
+// Minimal RadioLib shim: just the PhysicalLayer calls RadioLibWrapper makes, for a mock radio to implement
+#include <Arduino.h>
+
+#define RADIOLIB_ERR_NONE   0
+
+class PhysicalLayer {
+public:
+  virtual ~PhysicalLayer() { }
+  virtual void setPacketReceivedAction(void (*func)(void)) = 0;
+  virtual int16_t startReceive() = 0;
+  virtual size_t getPacketLength(bool update = true) = 0;
+  virtual int16_t readData(uint8_t* data, size_t len) = 0;
+  virtual int16_t standby() = 0;
+  virtual int16_t sleep() { return RADIOLIB_ERR_NONE; }
+  virtual int16_t startTransmit(uint8_t* data, size_t len, uint8_t addr = 0) = 0;
+  virtual int16_t finishTransmit() { return RADIOLIB_ERR_NONE; }
+  virtual uint32_t getTimeOnAir(size_t len) { return len * 1000; }
+  virtual float getRSSI() = 0;
+  virtual float getSNR() = 0;
+  virtual uint8_t randomByte() { return 0; }
+};
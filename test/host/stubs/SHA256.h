@@ -0,0 +1,27 @@
+#pragma once
+// Same interface as rweather Crypto's SHA256, implemented in host_stubs.cpp
+#include <stdint.h>
+#include <stddef.h>
+
+class SHA256 {
+public:
+  SHA256();
+  size_t hashSize() const { return 32; }
+  size_t blockSize() const { return 64; }
+  void reset();
+  void update(const void* data, size_t len);
+  void finalize(void* hash, size_t len);
+  void resetHMAC(const void* key, size_t keyLen);
+  void finalizeHMAC(const void* key, size_t keyLen, void* hash, size_t hashLen);
+  void clear();
+
+protected:
+  struct {
+    uint32_t h[8];
+    uint32_t w[16];
+    uint64_t length;
+    uint8_t chunkSize;
+    bool finalized;
+  } state;
+  void processChunk();
+};
@@ -0,0 +1,34 @@
+#pragma once
+// Minimal Arduino Print/Stream shim, Serial output goes to stdout
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+class Print {
+public:
+  virtual size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+  virtual size_t write(const uint8_t* b, size_t n) { return fwrite(b, 1, n, stdout); }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int n) { return printf("%d", n); }
+  size_t println(const char* s="") { return print(s) + print('\n'); }
+  size_t println(int n) { return print(n) + print('\n'); }
+  size_t printf(const char* fmt, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    return n > 0 ? write((const uint8_t*)buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1) : 0;
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  size_t readBytes(uint8_t* b, size_t n) { return 0; }
+  size_t readBytes(char* b, size_t n) { return 0; }
+};
@@ -0,0 +1,132 @@
+// Host implementations of the Arduino/Crypto pieces the core sources link against
+#include <Arduino.h>
+#include <SHA256.h>
+#include <chrono>
+
+Stream Serial;
+
+unsigned long millis() {
+  static auto start = std::chrono::steady_clock::now();
+  return (unsigned long) std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+long random(long min, long max) {
+  return min + rand() % (max - min);
+}
+
+static const uint32_t K[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t ror(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+SHA256::SHA256() { reset(); }
+
+void SHA256::reset() {
+  static const uint32_t init[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+  };
+  memcpy(state.h, init, sizeof(init));
+  state.length = 0;
+  state.chunkSize = 0;
+  state.finalized = false;
+}
+
+void SHA256::processChunk() {
+  uint32_t w[64];
+  const uint8_t* b = (const uint8_t*) state.w;
+  for (int i = 0; i < 16; i++) {
+    w[i] = ((uint32_t)b[i*4] << 24) | ((uint32_t)b[i*4 + 1] << 16) | ((uint32_t)b[i*4 + 2] << 8) | b[i*4 + 3];
+  }
+  for (int i = 16; i < 64; i++) {
+    uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+  uint32_t a = state.h[0], bb = state.h[1], c = state.h[2], d = state.h[3];
+  uint32_t e = state.h[4], f = state.h[5], g = state.h[6], h = state.h[7];
+  for (int i = 0; i < 64; i++) {
+    uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+    uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & bb) ^ (a & c) ^ (bb & c));
+    h = g; g = f; f = e; e = d + t1; d = c; c = bb; bb = a; a = t1 + t2;
+  }
+  state.h[0] += a; state.h[1] += bb; state.h[2] += c; state.h[3] += d;
+  state.h[4] += e; state.h[5] += f; state.h[6] += g; state.h[7] += h;
+}
+
+void SHA256::update(const void* data, size_t len) {
+  const uint8_t* d = (const uint8_t*) data;
+  state.length += (uint64_t)len * 8;
+  while (len > 0) {
+    size_t n = 64 - state.chunkSize;
+    if (n > len) n = len;
+    memcpy((uint8_t*)state.w + state.chunkSize, d, n);
+    state.chunkSize += n;
+    d += n; len -= n;
+    if (state.chunkSize == 64) {
+      processChunk();
+      state.chunkSize = 0;
+    }
+  }
+}
+
+void SHA256::finalize(void* hash, size_t len) {
+  if (!state.finalized) {
+    uint64_t bits = state.length;
+    uint8_t* buf = (uint8_t*) state.w;
+    buf[state.chunkSize++] = 0x80;
+    if (state.chunkSize > 56) {
+      memset(buf + state.chunkSize, 0, 64 - state.chunkSize);
+      processChunk();
+      state.chunkSize = 0;
+    }
+    memset(buf + state.chunkSize, 0, 56 - state.chunkSize);
+    for (int i = 0; i < 8; i++) buf[56 + i] = (uint8_t)(bits >> (56 - i*8));
+    processChunk();
+    for (int i = 0; i < 8; i++) {   // store big-endian digest in place
+      uint32_t v = state.h[i];
+      state.h[i] = ((v & 0xFF) << 24) | ((v & 0xFF00) << 8) | ((v >> 8) & 0xFF00) | (v >> 24);
+    }
+    state.finalized = true;
+  }
+  memcpy(hash, state.h, len < 32 ? len : 32);
+}
+
+static void xorKey(SHA256& sha, const void* key, size_t keyLen, uint8_t pad) {
+  uint8_t block[64];
+  memset(block, 0, sizeof(block));
+  if (keyLen > 64) {
+    SHA256 k;
+    k.update(key, keyLen);
+    k.finalize(block, 32);
+  } else {
+    memcpy(block, key, keyLen);
+  }
+  for (int i = 0; i < 64; i++) block[i] ^= pad;
+  sha.reset();
+  sha.update(block, 64);
+}
+
+void SHA256::resetHMAC(const void* key, size_t keyLen) {
+  xorKey(*this, key, keyLen, 0x36);
+}
+
+void SHA256::finalizeHMAC(const void* key, size_t keyLen, void* hash, size_t hashLen) {
+  uint8_t inner[32];
+  finalize(inner, 32);
+  xorKey(*this, key, keyLen, 0x5C);
+  update(inner, 32);
+  finalize(hash, hashLen);
+}
+
+void SHA256::clear() {
+  memset(&state, 0, sizeof(state));
+  reset();
+}
@@ -0,0 +1,148 @@
+// RadioLibWrapper receive queue, against a mock radio which (like the real chips) has one packet buffer that the
+// next packet overwrites: packets come out in order with their own SNR/RSSI, what is lost when the main loop doesn't
+// poll, and a TX-done IRQ isn't read as a packet. Built for the default RADIO_RX_QUEUE_SIZE, for 4, and for 4 with
+// RADIO_RX_IN_ISR (the mock fires the IRQ handler synchronously, as if it interrupted the main loop).
+#include <helpers/radiolib/RadioLibWrappers.h>
+#include <cstdio>
+
+struct MockRadio : PhysicalLayer {
+  void (*irq)(void) = NULL;
+  bool in_rx = false;
+  uint8_t fifo[256];
+  size_t fifo_len = 0;
+  float snr = 0, rssi = 0;
+
+  void setPacketReceivedAction(void (*func)(void)) override { irq = func; }
+  int16_t startReceive() override { in_rx = true; return RADIOLIB_ERR_NONE; }
+  size_t getPacketLength(bool update) override { return fifo_len; }
+  int16_t readData(uint8_t* data, size_t len) override { memcpy(data, fifo, len); return RADIOLIB_ERR_NONE; }
+  int16_t standby() override { in_rx = false; return RADIOLIB_ERR_NONE; }
+  int16_t startTransmit(uint8_t* data, size_t len, uint8_t addr) override { in_rx = false; return RADIOLIB_ERR_NONE; }
+  float getRSSI() override { return rssi; }
+  float getSNR() override { return snr; }
+
+  // a packet arrives over the air: the radio (in RX continuous mode) overwrites its buffer, then fires the IRQ
+  bool deliver(uint8_t id, int len) {
+    if (!in_rx) return false;
+    memset(fifo, id, len);
+    fifo_len = len;
+    snr = id / 4.0f;
+    rssi = -id;
+    irq();
+    return true;
+  }
+};
+
+struct TestBoard : mesh::MainBoard {
+  uint16_t getBattMilliVolts() override { return 0; }
+  const char* getManufacturerName() const override { return "host"; }
+  void reboot() override { }
+  uint8_t getStartupReason() const override { return BD_STARTUP_NORMAL; }
+};
+
+struct TestWrapper : RadioLibWrapper {
+  TestWrapper(PhysicalLayer& radio, mesh::MainBoard& board) : RadioLibWrapper(radio, board) { }
+  bool isReceivingPacket() override { return false; }
+  float getCurrentRSSI() override { return -110; }
+};
+
+#define CHECK(cond)  if (!(cond)) { printf("FAIL: line %d: %s\n", __LINE__, #cond); return 1; }
+
+// takes all packets the wrapper has, as the Dispatcher would. Returns -1 if a packet is corrupt or has the wrong SNR/RSSI
+static int drain(TestWrapper& wrapper, uint8_t ids[], int max_ids) {
+  uint8_t buf[MAX_TRANS_UNIT + 1];
+  int n = 0, len;
+  while ((len = wrapper.recvRaw(buf, MAX_TRANS_UNIT)) > 0) {
+    for (int i = 0; i < len; i++) if (buf[i] != buf[0]) return -1;
+    if (wrapper.getLastSNR() != buf[0] / 4.0f || wrapper.getLastRSSI() != -buf[0]) return -1;
+    if (n < max_ids) ids[n] = buf[0];
+    n++;
+  }
+  return n;
+}
+
+int main() {
+  MockRadio radio;
+  TestBoard board;
+  TestWrapper wrapper(radio, board);
+  uint8_t buf[MAX_TRANS_UNIT + 1], ids[256];
+
+  wrapper.begin();
+  CHECK(wrapper.recvRaw(buf, MAX_TRANS_UNIT) == 0);   // starts RX
+  CHECK(radio.in_rx);
+
+  // bursts of back-to-back packets, with a poll (ie. a loop() pass) after each, up to one more than the queue holds
+  int sent = 0, got = 0;
+  for (int burst = 0; burst < 1000; burst++) {
+    int k = 1 + burst % (RADIO_RX_QUEUE_SIZE + 1);
+    for (int i = 0; i < k; i++) {
+      CHECK(radio.deliver(1 + sent % 200, 10 + i));
+      sent++;
+      wrapper.loop();
+    }
+    int n = drain(wrapper, ids, 256);
+    CHECK(n == k);
+    for (int i = 0; i < n; i++) CHECK(ids[i] == 1 + (got + i) % 200);   // in order
+    got += n;
+  }
+  CHECK(wrapper.getPacketsRecv() == (uint32_t) sent);
+  printf("bursts of 1..%d, polled between: sent=%d received=%d\n", RADIO_RX_QUEUE_SIZE + 1, sent, got);
+
+  // more than that: the queue is full, the next waits in the radio, the rest overwrite it
+  uint32_t full_before = wrapper.getPacketsRecvQueueFull();
+  for (int i = 0; i < RADIO_RX_QUEUE_SIZE + 3; i++) {
+    CHECK(radio.deliver(201 + i, 20));
+    wrapper.loop();
+  }
+  int n = drain(wrapper, ids, 256);
+  CHECK(n == RADIO_RX_QUEUE_SIZE + 1);
+  for (int i = 0; i < RADIO_RX_QUEUE_SIZE; i++) CHECK(ids[i] == 201 + i);
+  CHECK(ids[RADIO_RX_QUEUE_SIZE] == 201 + RADIO_RX_QUEUE_SIZE + 2);   // the last one to arrive
+  CHECK(wrapper.getPacketsRecvQueueFull() > full_before);
+  printf("%d back-to-back, polled between: received %d\n", RADIO_RX_QUEUE_SIZE + 3, n);
+
+#if RADIO_RX_IN_ISR
+  // no polls at all (main loop blocked): the IRQ handler queues each one, and the one after a full queue waits in radio
+  for (int i = 0; i <= RADIO_RX_QUEUE_SIZE; i++) CHECK(radio.deliver(220 + i, 20));
+  n = drain(wrapper, ids, 256);
+  CHECK(n == RADIO_RX_QUEUE_SIZE + 1);
+  for (int i = 0; i < n; i++) CHECK(ids[i] == 220 + i);
+  printf("%d back-to-back, no polls: received %d\n", RADIO_RX_QUEUE_SIZE + 1, n);
+
+  // main loop using the radio: the IRQ handler leaves the packet, and it's read when the mask is released
+  {
+    RadioLibWrapper::RecvIRQMask outer(&wrapper);
+    {
+      RadioLibWrapper::RecvIRQMask inner(&wrapper);
+      CHECK(radio.deliver(235, 20));
+    }
+    CHECK(wrapper.getNumRecvQueued() == 0);   // still masked by outer
+  }
+  CHECK(wrapper.getNumRecvQueued() == 1 && radio.in_rx);
+  CHECK(radio.deliver(236, 20));   // and the IRQ handler reads them again after
+  n = drain(wrapper, ids, 256);
+  CHECK(n == 2 && ids[0] == 235 && ids[1] == 236);
+#else
+  // no polls at all (main loop blocked): only the last packet survives, whatever the queue size
+  for (int i = 0; i < 3; i++) CHECK(radio.deliver(230 + i, 20));
+  n = drain(wrapper, ids, 256);
+  CHECK(n == 1 && ids[0] == 232);
+  printf("3 back-to-back, no polls: received %d\n", n);
+#endif
+
+  // the IRQ is also TX done, which mustn't be read as a received packet
+  CHECK(wrapper.startSendRaw(buf, 20));
+  radio.irq();
+  wrapper.loop();
+  CHECK(wrapper.getNumRecvQueued() == 0);
+  CHECK(wrapper.isSendComplete());
+  wrapper.onSendFinished();
+  CHECK(wrapper.recvRaw(buf, MAX_TRANS_UNIT) == 0);   // restarts RX
+  CHECK(radio.in_rx);
+  CHECK(radio.deliver(240, 30));
+  n = drain(wrapper, ids, 256);
+  CHECK(n == 1 && ids[0] == 240);
+
+  printf("RADIO_RX_QUEUE_SIZE=%d RADIO_RX_IN_ISR=%d: OK, queue RAM=%d bytes\n", RADIO_RX_QUEUE_SIZE, RADIO_RX_IN_ISR, (int) (RADIO_RX_QUEUE_SIZE * sizeof(RadioRecvSlot)));
+  return 0;
+}
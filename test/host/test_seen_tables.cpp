@@ -0,0 +1,84 @@
+// SimpleMeshTables: duplicates found, oldest displaced when full, entries expire by age (including
+// after a long idle), and a saveTo() snapshot restores after reboot. Built for the defaults, and for SEEN_TABLES_SMALL.
+#include <helpers/SimpleMeshTables.h>
+#include <cstdio>
+
+struct TestClock : mesh::MillisecondClock {
+  unsigned long t = 5000000;
+  unsigned long getMillis() override { return t; }
+};
+
+static mesh::Packet pkt;
+
+static mesh::Packet* packetFor(uint32_t id, uint8_t type=PAYLOAD_TYPE_TXT_MSG) {
+  pkt.header = (type << PH_TYPE_SHIFT) | ROUTE_TYPE_FLOOD;
+  pkt.payload_len = 20;
+  memset(pkt.payload, 0, pkt.payload_len);
+  memcpy(pkt.payload, &id, 4);
+  pkt.invalidateHash();
+  return &pkt;
+}
+
+#define CHECK(cond)  if (!(cond)) { printf("FAIL: line %d: %s\n", __LINE__, #cond); return 1; }
+
+int main() {
+  TestClock clock;
+  SimpleMeshTables tables;
+  tables.setClock(&clock);
+
+  // duplicates, and oldest displaced when full
+  for (uint32_t i = 1; i <= MAX_PACKET_HASHES; i++) CHECK(!tables.hasSeen(packetFor(i)));
+  for (uint32_t i = 1; i <= MAX_PACKET_HASHES; i++) CHECK(tables.hasSeen(packetFor(i)));
+  CHECK(!tables.hasSeen(packetFor(1000)));   // displaces id 1
+  CHECK(!tables.hasSeen(packetFor(1)));
+  CHECK(tables.hasSeen(packetFor(MAX_PACKET_HASHES)));
+  for (uint32_t i = 1; i <= MAX_PACKET_ACKS; i++) CHECK(!tables.hasSeen(packetFor(i, PAYLOAD_TYPE_ACK)));
+  CHECK(tables.hasSeen(packetFor(1, PAYLOAD_TYPE_ACK)));
+  tables.clear(packetFor(1, PAYLOAD_TYPE_ACK));
+  CHECK(!tables.hasSeen(packetFor(1, PAYLOAD_TYPE_ACK)));
+
+  // expiry by age
+  SimpleMeshTables aged;
+  aged.setClock(&clock);
+  aged.hasSeen(packetFor(1));
+  clock.t += SEEN_EXPIRY_MILLIS / 2;
+  aged.hasSeen(packetFor(2));
+  CHECK(aged.hasSeen(packetFor(1)));
+  clock.t += SEEN_EXPIRY_MILLIS / 2 + 1000;
+  CHECK(!aged.hasSeen(packetFor(1)));   // expired, so new again
+  CHECK(aged.hasSeen(packetFor(2)));
+
+  // idle for ~18 hours
+  clock.t += 65536000UL + 5000;
+  CHECK(!aged.hasSeen(packetFor(2)));
+
+  // snapshot, restored after a 60 sec gap, with clock just after boot
+  for (uint32_t i = 1; i <= 300; i++) { tables.hasSeen(packetFor(i * 7919)); clock.t += 1000; }
+  static uint8_t buf[8192];
+  int len = tables.saveTo(buf, sizeof(buf), 1000000);
+  CHECK(len > 0);
+  TestClock boot_clock;
+  boot_clock.t = 1500;
+  SimpleMeshTables restored;
+  restored.setClock(&boot_clock);
+  CHECK(restored.restoreFrom(buf, len, 1000060, false));
+  CHECK(restored.getNumHashes() == tables.getNumHashes());
+  CHECK(restored.hasSeen(packetFor(300 * 7919)));
+  CHECK(!restored.hasSeen(packetFor(7919)));   // was displaced before the snapshot
+
+  SimpleMeshTables rtc_back;
+  rtc_back.setClock(&boot_clock);
+  CHECK(!rtc_back.restoreFrom(buf, len, 5, false));   // age unknown
+  CHECK(rtc_back.restoreFrom(buf, len, 5, true));     // ok, RAM retained over a quick reset
+  buf[20] ^= 1;
+  CHECK(!restored.restoreFrom(buf, len, 1000060, false));   // corrupt
+
+  // on the 32-bit targets: keys, 32-bit timestamps, and a 16-bit index of 2x capacity (rounded up to power of 2)
+  int index_h = 8, index_a = 8;
+  while (index_h < MAX_PACKET_HASHES*2) index_h <<= 1;
+  while (index_a < MAX_PACKET_ACKS*2) index_a <<= 1;
+  int ram = MAX_PACKET_HASHES*(MAX_HASH_SIZE + 4) + index_h*2 + MAX_PACKET_ACKS*(ACK_KEY_SIZE + 4) + index_a*2;
+  printf("seen tables ok, %d hashes + %d acks: ~%d bytes (fixed tables were %d)\n", MAX_PACKET_HASHES, MAX_PACKET_ACKS,
+      ram, 128*MAX_HASH_SIZE + 64*4);
+  return 0;
+}
@@ -0,0 +1,171 @@
+// SlabPacketManager: packets come back out of the queues identical to what went in (compact/expand
+// round trip), queued floods are found by packet hash, a slot can't be released twice, an ACK still gets
+// queued when a flood burst has filled the manager, a burst fills the queues as deep as
+// StaticPoolPacketManager(32), and RAM use of both.
+#include <helpers/SlabPacketManager.h>
+#include <cstdio>
+#include <cstdlib>
+
+// repeater's USE_SLAB_PACKET_MANAGER sizing (see examples/simple_repeater/MyMesh.h)
+#define NUM_WORKING   6
+#define NUM_SMALL    12
+#define NUM_MEDIUM   12
+#define NUM_LARGE     6
+
+// on the 32-bit targets: ScheduledQueue::Entry is 20 bytes, pointers are 4
+static int queueRAM(int entries) { return entries * 20; }
+static int poolRAM(int n) { return n * (sizeof(mesh::Packet) + 4); }
+static int slabRAM(int slot_size, int n) { return n * (slot_size + SLAB_SLOT_HEADER_SIZE + 4); }
+
+static void randomPacket(mesh::Packet* p, int max_payload) {
+  p->header = rand() & 0xFF;
+  if (p->header == 0xFF) p->header = 0;
+  p->transport_codes[0] = p->transport_codes[1] = 0;
+  if (p->hasTransportCodes()) { p->transport_codes[0] = rand(); p->transport_codes[1] = rand(); }
+  p->path_len = rand() % 8;
+  for (int i = 0; i < MAX_PATH_SIZE; i++) p->path[i] = rand();
+  p->payload_len = rand() % max_payload;
+  for (int i = 0; i < p->payload_len; i++) p->payload[i] = rand();
+  p->_snr = rand();
+  p->_tx_class = rand() % NUM_TX_CLASSES;
+}
+
+static bool samePacket(const mesh::Packet* a, const mesh::Packet* b) {
+  int path_bytes = (a->path_len & 63) * ((a->path_len >> 6) + 1);
+  return a->header == b->header && a->path_len == b->path_len && a->payload_len == b->payload_len
+    && memcmp(a->path, b->path, path_bytes) == 0 && memcmp(a->payload, b->payload, a->payload_len) == 0
+    && a->transport_codes[0] == b->transport_codes[0] && a->transport_codes[1] == b->transport_codes[1]
+    && a->_snr == b->_snr && a->_tx_class == b->_tx_class;
+}
+
+static bool checkRoundTrip() {
+  SlabPacketManager mgr(3, 4, 4, 2);
+  for (int it = 0; it < 2000; it++) {
+    mesh::Packet* p = mgr.allocNew();
+    randomPacket(p, MAX_PACKET_PAYLOAD - 20);
+    mesh::Packet copy = *p;
+    mgr.queueOutbound(p, rand() % 3, 0, 0, 0);
+    mesh::Packet* q = mgr.getNextOutbound(10, TX_CLASS_MASK_ALL);
+    if (q == NULL || !samePacket(q, &copy)) { printf("FAIL: packet changed in queue, iteration %d\n", it); return false; }
+    mgr.free(q);
+  }
+  if (mgr.getFreeCount() != 3) { printf("FAIL: working packets leaked\n"); return false; }
+  printf("compact/expand round trip ok\n");
+  return true;
+}
+
+// both managers: queued flood packets (compact or not) are found by hash, direct ones aren't
+static bool checkFindFlood(mesh::PacketManager& mgr, const char* name) {
+  uint8_t hashes[8][MAX_HASH_SIZE];
+  bool flood[8];
+  for (int i = 0; i < 8; i++) {
+    mesh::Packet* p = mgr.allocNew();
+    if (p == NULL) break;
+    randomPacket(p, i < 4 ? 16 : 150);   // small ones are compacted by the slab manager, large ones may not be
+    p->header = (p->header & ~PH_ROUTE_MASK) | (i % 3 == 0 ? ROUTE_TYPE_DIRECT : ROUTE_TYPE_FLOOD);
+    flood[i] = p->isRouteFlood();
+    p->calculatePacketHash(hashes[i]);
+    mgr.queueOutbound(p, 1, 1000, 0, 0);
+  }
+  for (int i = 0; i < 8; i++) {
+    int idx = mgr.findOutboundFlood(hashes[i]);
+    if (flood[i] != (idx >= 0)) { printf("FAIL: %s findOutboundFlood(), packet %d\n", name, i); return false; }
+    if (idx < 0) continue;
+    uint8_t h[MAX_HASH_SIZE];
+    mgr.getOutboundByIdx(idx)->calculatePacketHash(h);
+    if (memcmp(h, hashes[i], MAX_HASH_SIZE) != 0) { printf("FAIL: %s findOutboundFlood(), wrong index\n", name); return false; }
+  }
+  mesh::Packet* p;
+  while ((p = mgr.getNextOutbound(2000, TX_CLASS_MASK_ALL)) != NULL) mgr.free(p);
+  printf("%s: findOutboundFlood ok\n", name);
+  return true;
+}
+
+static bool checkSlabRelease() {
+  ByteSlab slab;
+  slab.begin(16, 2);
+  uint8_t* a = slab.alloc();
+  if (!slab.release(a)) { printf("FAIL: ByteSlab::release()\n"); return false; }
+  if (slab.release(a) || slab.getFreeCount() != 2) { printf("FAIL: ByteSlab double free accepted\n"); return false; }
+  if (slab.alloc() != a || slab.alloc() == a) { printf("FAIL: ByteSlab free list corrupted\n"); return false; }
+  printf("ByteSlab double free rejected\n");
+  return true;
+}
+
+// fill with floods of 'payload_len' bytes until the send queue stops taking them, then send an ACK
+static bool checkAckAfterFill(mesh::PacketManager& mgr, const char* name, int payload_len) {
+  for (int i = 0; i < 100; i++) {
+    mesh::Packet* p = mgr.allocNew();
+    if (p == NULL) { printf("FAIL: %s pool empty after %d floods\n", name, i); return false; }
+    randomPacket(p, MAX_PACKET_PAYLOAD);
+    p->header = (PAYLOAD_TYPE_GRP_TXT << PH_TYPE_SHIFT) | ROUTE_TYPE_FLOOD;
+    p->payload_len = payload_len;
+    mgr.queueOutbound(p, 3, 1000, 0, 0);
+  }
+  int before = mgr.getOutboundTotal();
+  mesh::Packet* ack = mgr.allocNew();
+  if (ack == NULL) { printf("FAIL: %s no packet for ACK\n", name); return false; }
+  ack->header = (PAYLOAD_TYPE_ACK << PH_TYPE_SHIFT) | ROUTE_TYPE_DIRECT;
+  ack->path_len = 0;
+  ack->payload_len = 4;
+  memcpy(ack->payload, "\x01\x02\x03\x04", 4);
+  mgr.queueOutbound(ack, 0, 1000, 0, 0);
+
+  mesh::Packet* next = mgr.getNextOutbound(2000, TX_CLASS_MASK_ALL);
+  if (next == NULL || next->getPayloadType() != PAYLOAD_TYPE_ACK || memcmp(next->payload, "\x01\x02\x03\x04", 4) != 0) {
+    printf("FAIL: %s ACK not queued\n", name);
+    return false;
+  }
+  mgr.free(next);
+  while ((next = mgr.getNextOutbound(2000, TX_CLASS_MASK_ALL)) != NULL) mgr.free(next);
+  printf("%s: %d floods (payload %d) queued, ACK still queued (%u evicted)\n", name, before, payload_len,
+      mgr.getNumDropped(DROP_TX_EVICTED));
+  return true;
+}
+
+static int fillQueue(mesh::PacketManager& mgr) {
+  mesh::Packet tmp;
+  int n = 0;
+  for (int i = 0; i < 64; i++) {   // mixed flood burst: ACKs, short msgs, adverts
+    mesh::Packet* p = mgr.allocNew();
+    if (p == NULL) break;
+    int r = rand() % 3;
+    randomPacket(p, r == 0 ? 16 : r == 1 ? 80 : 150);
+    int before = mgr.getOutboundTotal();
+    mgr.queueOutbound(p, 3, 1000, 0, 0);
+    if (mgr.getOutboundTotal() == before) break;   // queue full
+    n++;
+  }
+  return n;
+}
+
+int main() {
+  if (!checkRoundTrip()) return 1;
+  if (!checkSlabRelease()) return 1;
+  {
+    SlabPacketManager slab(3, 4, 4, 2);
+    StaticPoolPacketManager pool(12);
+    if (!checkFindFlood(slab, "SlabPacketManager") || !checkFindFlood(pool, "StaticPoolPacketManager")) return 1;
+  }
+  static const int payload_lens[] = { 10, 60, 150 };   // small, medium, large slots
+  for (int payload_len : payload_lens) {
+    SlabPacketManager slab(NUM_WORKING, NUM_SMALL, NUM_MEDIUM, NUM_LARGE);
+    StaticPoolPacketManager pool(32);
+    if (!checkAckAfterFill(slab, "SlabPacketManager", payload_len) || !checkAckAfterFill(pool, "StaticPoolPacketManager", payload_len)) return 1;
+  }
+
+  SlabPacketManager slab(NUM_WORKING, NUM_SMALL, NUM_MEDIUM, NUM_LARGE);
+  StaticPoolPacketManager pool(32);
+  int slab_depth = fillQueue(slab);
+  int pool_depth = fillQueue(pool);
+
+  int entries = NUM_WORKING + NUM_SMALL + NUM_MEDIUM + NUM_LARGE;
+  int slab_ram = poolRAM(NUM_WORKING) + slabRAM(SLAB_SMALL_SLOT_SIZE, NUM_SMALL) + slabRAM(SLAB_MEDIUM_SLOT_SIZE, NUM_MEDIUM)
+      + slabRAM(SLAB_LARGE_SLOT_SIZE, NUM_LARGE) + 2*queueRAM(entries);
+  int pool_ram = poolRAM(32) + queueRAM(32 - OUTBOUND_QUEUE_RESERVE) + queueRAM(32);
+  printf("StaticPoolPacketManager(32):  ~%5d bytes, burst queued %d\n", pool_ram, pool_depth);
+  printf("SlabPacketManager(%d,%d,%d,%d): ~%5d bytes, burst queued %d\n", NUM_WORKING, NUM_SMALL, NUM_MEDIUM, NUM_LARGE,
+      slab_ram, slab_depth);
+  if (slab_depth < pool_depth - OUTBOUND_QUEUE_RESERVE) { printf("FAIL: slab queue much shallower\n"); return 1; }
+  return 0;
+}